@@ -0,0 +1,213 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Animation/AnimNode_HitReactSpring.h"
+
+#include "HitReact.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimInstanceProxy.h"
+#include "Animation/AnimTrace.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimNode_HitReactSpring)
+
+void FAnimNode_HitReactSpring::Initialize_AnyThread(const FAnimationInitializeContext& Context)
+{
+	FAnimNode_Base::Initialize_AnyThread(Context);
+	Source.Initialize(Context);
+
+	Springs.Reset();
+}
+
+void FAnimNode_HitReactSpring::CacheBones_AnyThread(const FAnimationCacheBonesContext& Context)
+{
+	Source.CacheBones(Context);
+}
+
+void FAnimNode_HitReactSpring::PreUpdate(const UAnimInstance* InAnimInstance)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_HitReactSpring::PreUpdate);
+
+	// Game thread, safe to access the owner
+	if (!bSearchedForHitReact)
+	{
+		bSearchedForHitReact = true;
+		const AActor* Owner = InAnimInstance->GetOwningActor();
+		HitReact = Owner ? Owner->FindComponentByClass<UHitReact>() : nullptr;
+		SpringImpulseSerial = HitReact.IsValid() ? HitReact->GetSpringImpulseSerial() : 0;
+	}
+
+	UHitReact* HitReactComponent = HitReact.Get();
+	const USkeletalMeshComponent* Mesh = InAnimInstance->GetSkelMeshComponent();
+	if (!HitReactComponent || !Mesh)
+	{
+		return;
+	}
+
+	HitReactComponent->GetSpringImpulses(SpringImpulseSerial, ConsumedImpulses);
+	for (const FHitReactPendingImpulse& Impulse : ConsumedImpulses)
+	{
+		AddImpulse(Mesh, Impulse);
+	}
+	ConsumedImpulses.Reset();
+}
+
+void FAnimNode_HitReactSpring::AddImpulse(const USkeletalMeshComponent* Mesh, const FHitReactPendingImpulse& Impulse)
+{
+	const FName HitBoneName = Impulse.ImpulseBoneName;
+	if (Mesh->GetBoneIndex(HitBoneName) == INDEX_NONE)
+	{
+		return;
+	}
+
+	const FHitReactImpulse_Linear& LinearParams = Impulse.Impulse.LinearImpulse;
+	const FHitReactImpulse_Angular& AngularParams = Impulse.Impulse.AngularImpulse;
+	const FHitReactImpulse_Radial& RadialParams = Impulse.Impulse.RadialImpulse;
+
+	// Linear and radial impulses rotate the hit bone about its parent
+	const FName PivotBoneName = Mesh->GetParentBone(HitBoneName);
+	const FVector HitLocation = Mesh->GetBoneLocation(HitBoneName);
+	const FVector PivotLocation = PivotBoneName.IsNone() ? Mesh->GetComponentLocation() : Mesh->GetBoneLocation(PivotBoneName);
+	const FVector Arm = HitLocation - PivotLocation;
+
+	FVector LinearVelocity = FVector::ZeroVector;
+	if (LinearParams.CanBeApplied())
+	{
+		LinearVelocity += LinearParams.GetImpulse(Impulse.World.LinearDirection);
+	}
+	if (RadialParams.CanBeApplied())
+	{
+		const FVector Delta = HitLocation - Impulse.World.RadialLocation;
+		const float Distance = Delta.Size();
+		if (Distance < RadialParams.Radius)
+		{
+			const float Falloff = RadialParams.Falloff == EHitReactFalloff::Linear ? 1.f - Distance / RadialParams.Radius : 1.f;
+			LinearVelocity += Delta.GetSafeNormal() * RadialParams.Impulse * Falloff;
+		}
+	}
+
+	// Angular velocity about the pivot, w = r x v / |r|^2
+	FVector AngularVelocity = FVector::CrossProduct(Arm, LinearVelocity * LinearImpulseScale) / FMath::Max(Arm.SizeSquared(), 1.f);
+	if (AngularParams.CanBeApplied())
+	{
+		const FVector Angular = AngularParams.GetImpulse(Impulse.World.AngularDirection);
+		AngularVelocity += (AngularParams.AngularUnits == EHitReactUnits::Degrees ? FMath::DegreesToRadians(Angular) : Angular) * AngularImpulseScale;
+	}
+	AngularVelocity *= Impulse.ImpulseScalar;
+
+	if (AngularVelocity.IsNearlyZero())
+	{
+		return;
+	}
+
+	// Apply to the hit bone and its parents, in the space of each bone's parent
+	FName BoneName = HitBoneName;
+	float ChainScalar = 1.f;
+	for (int32 Depth = 0; Depth <= ChainDepth && !BoneName.IsNone(); Depth++)
+	{
+		const FName ParentBoneName = Mesh->GetParentBone(BoneName);
+		const FQuat ParentRotation = ParentBoneName.IsNone() ? Mesh->GetComponentQuat() : Mesh->GetBoneQuaternion(ParentBoneName);
+
+		FHitReactSpringBone* Spring = Springs.FindByPredicate([&BoneName](const FHitReactSpringBone& Bone)
+		{
+			return Bone.BoneName == BoneName;
+		});
+		if (!Spring)
+		{
+			Spring = &Springs.AddDefaulted_GetRef();
+			Spring->BoneName = BoneName;
+		}
+		Spring->Velocity += ParentRotation.UnrotateVector(AngularVelocity * ChainScalar);
+
+		BoneName = ParentBoneName;
+		ChainScalar *= ChainFalloff;
+	}
+}
+
+void FAnimNode_HitReactSpring::StepSpring(FVector& Angle, FVector& Velocity, float AngularFrequency, float DampingRatio,
+	float DeltaTime)
+{
+	// Underdamped harmonic oscillator
+	const float DampedFrequency = AngularFrequency * FMath::Sqrt(1.f - DampingRatio * DampingRatio);
+	const float Decay = FMath::Exp(-DampingRatio * AngularFrequency * DeltaTime);
+	float Sin, Cos;
+	FMath::SinCos(&Sin, &Cos, DampedFrequency * DeltaTime);
+
+	const FVector X0 = Angle;
+	const FVector V0 = Velocity;
+	Angle = Decay * (X0 * Cos + (V0 + DampingRatio * AngularFrequency * X0) * (Sin / DampedFrequency));
+	Velocity = Decay * (V0 * Cos - (AngularFrequency * AngularFrequency * X0 + DampingRatio * AngularFrequency * V0) * (Sin / DampedFrequency));
+}
+
+void FAnimNode_HitReactSpring::Update_AnyThread(const FAnimationUpdateContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_HitReactSpring::Update_AnyThread);
+
+	GetEvaluateGraphExposedInputs().Execute(Context);
+	Source.Update(Context);
+
+	const float DeltaTime = Context.GetDeltaTime();
+	if (Springs.Num() == 0 || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	const float AngularFrequency = UE_TWO_PI * FMath::Max(0.1f, Frequency);
+	const float Damping = FMath::Clamp(DampingRatio, 0.05f, 0.95f);
+	const float MaxAngleRadians = FMath::DegreesToRadians(MaxAngle);
+
+	Springs.RemoveAll([&](FHitReactSpringBone& Spring)
+	{
+		StepSpring(Spring.Angle, Spring.Velocity, AngularFrequency, Damping, DeltaTime);
+		Spring.Angle = Spring.Angle.GetClampedToMaxSize(MaxAngleRadians);
+
+		// Remove once at rest
+		return Spring.Angle.IsNearlyZero(1e-3f) && Spring.Velocity.IsNearlyZero(1e-2f);
+	});
+
+	TRACE_ANIM_NODE_VALUE(Context, TEXT("Springs"), Springs.Num());
+}
+
+void FAnimNode_HitReactSpring::Evaluate_AnyThread(FPoseContext& Output)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAnimNode_HitReactSpring::Evaluate_AnyThread);
+
+	Source.Evaluate(Output);
+
+	if (Springs.Num() == 0 || Alpha <= 0.f)
+	{
+		return;
+	}
+
+	const FBoneContainer& RequiredBones = Output.Pose.GetBoneContainer();
+	for (const FHitReactSpringBone& Spring : Springs)
+	{
+		const int32 MeshBoneIndex = RequiredBones.GetPoseBoneIndexForBoneName(Spring.BoneName);
+		if (MeshBoneIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Not required at this LOD
+		const FCompactPoseBoneIndex BoneIndex = RequiredBones.MakeCompactPoseIndex(FMeshPoseBoneIndex(MeshBoneIndex));
+		if (!BoneIndex.IsValid())
+		{
+			continue;
+		}
+
+		// Rotate about the bone's joint, in the space of its parent
+		FTransform& BoneTransform = Output.Pose[BoneIndex];
+		const FQuat Delta = FQuat::MakeFromRotationVector(Spring.Angle * Alpha);
+		BoneTransform.SetRotation((Delta * BoneTransform.GetRotation()).GetNormalized());
+	}
+}
+
+void FAnimNode_HitReactSpring::GatherDebugData(FNodeDebugData& DebugData)
+{
+	FString DebugLine = DebugData.GetNodeName(this);
+	DebugLine += FString::Printf(TEXT("(Alpha: %.1f%% Springs: %d)"), Alpha * 100.f, Springs.Num());
+	DebugData.AddDebugItem(DebugLine);
+
+	Source.GatherDebugData(DebugData);
+}
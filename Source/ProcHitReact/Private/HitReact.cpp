@@ -7,12 +7,21 @@
 #include "HitReactStatics.h"
 #include "Misc/DataValidation.h"
 #include "PhysicsEngine/PhysicalAnimationComponent.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/PhysicsConstraintTemplate.h"
 #include "HAL/IConsoleManager.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Animation/Skeleton.h"
+#include "Async/Async.h"
+#include "Engine/SkeletalMesh.h"
 #include "Engine/World.h"
 #include "Logging/MessageLog.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 #if UE_ENABLE_DEBUG_DRAWING
 #include "Engine/Engine.h"  // GEngine
@@ -25,8 +34,13 @@
 #endif
 
 #include "HitReactBoneData.h"
+#include "Physics/HitReactAsyncPhysics.h"
+#include "System/HitReactProfileCache.h"
+#include "System/HitReactClientRelay.h"
+#include "System/HitReactRecorder.h"
 
 #if WITH_EDITOR
+#include "Containers/Ticker.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #endif
@@ -69,6 +83,16 @@ namespace FHitReactCVars
 		ECVF_Default);
 #endif
 
+#if WITH_EDITOR
+	static int32 MaxLoggedRejectionsPerSecond = 10;
+	FAutoConsoleVariableRef CVarMaxLoggedRejectionsPerSecond(
+		TEXT("p.HitReact.Debug.MaxLoggedRejectionsPerSecond"),
+		MaxLoggedRejectionsPerSecond,
+		TEXT("Maximum number of rejected hit reacts added to the PIE message log per second, across all components. Further rejections are counted and summarized instead.\n")
+		TEXT("0: Never log rejections, -1: Log every rejection"),
+		ECVF_Default);
+#endif
+
 #if !UE_BUILD_SHIPPING
 	static int32 HitReactDisabled = 0;
 	FAutoConsoleVariableRef CVarHitReactDisabled(
@@ -95,6 +119,93 @@ namespace FHitReactCVars
 #endif
 }
 
+#if UE_ENABLE_DEBUG_DRAWING
+namespace HitReactDebug
+{
+	/** Debug output enabled for a component, cached once per frame, see UHitReact::GetDebugFlags() */
+	enum : uint8
+	{
+		Result			= 1 << 0,
+		BlendWeights	= 1 << 1,
+		BoneWeights		= 1 << 2,
+		Count			= 1 << 3,
+	};
+}
+#endif
+
+/** Where to report the result of a hit react, see UHitReact::GetDebugResultOutputs() */
+namespace HitReactDebugResult
+{
+	enum : uint8
+	{
+		Screen		= 1 << 0,
+		MessageLog	= 1 << 1,
+	};
+}
+
+#if WITH_EDITOR
+/** Rate limits rejections logged to the message log across all components, see p.HitReact.Debug.MaxLoggedRejectionsPerSecond */
+namespace HitReactRejectionLog
+{
+	static double WindowStartTime = 0.0;
+	static int32 NumLogged = 0;
+	static int32 NumSuppressed = 0;
+	static bool bFlushScheduled = false;
+
+	/** Log how many rejections were suppressed, and begin a new window once the current one has ended */
+	static void Flush(double Now, bool bForce)
+	{
+		if (!bForce && Now - WindowStartTime < 1.0)
+		{
+			return;
+		}
+
+		if (NumSuppressed > 0)
+		{
+			FMessageLog("PIE").Warning(FText::FromString(FString::Printf(
+				TEXT("HitReact: %d rejected hit reacts were not logged, see p.HitReact.Debug.MaxLoggedRejectionsPerSecond"), NumSuppressed)));
+		}
+		WindowStartTime = Now;
+		NumLogged = 0;
+		NumSuppressed = 0;
+	}
+
+	/** Flush from the core ticker when the window ends, rejections may stop arriving before then */
+	static void ScheduleFlush()
+	{
+		if (bFlushScheduled)
+		{
+			return;
+		}
+		bFlushScheduled = true;
+
+		const float Delay = FMath::Max(0.f, static_cast<float>(WindowStartTime + 1.0 - FPlatformTime::Seconds()));
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+		{
+			bFlushScheduled = false;
+			Flush(FPlatformTime::Seconds(), true);
+			return false;  // Once only
+		}), Delay);
+	}
+}
+#endif
+
+/**
+ * Report the result of a hit react, the message is only formatted if it will be output
+ * Arguments are not evaluated either, so they can be as expensive as needed
+ */
+#define HIT_REACT_DEBUG_RESULTF(bFailed, Format, ...) \
+	do \
+	{ \
+		if (const uint8 DebugResultOutputs = GetDebugResultOutputs(bFailed)) \
+		{ \
+			OutputDebugResult(*FString::Printf(Format, ##__VA_ARGS__), bFailed, DebugResultOutputs); \
+		} \
+	} while (0)
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Simulate Flips"), STAT_HitReactSimulateFlips, STATGROUP_HitReact);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Physics State Creations"), STAT_HitReactPhysicsStateCreations, STATGROUP_HitReact);
+
 #define LOCTEXT_NAMESPACE "HitReact"
 
 UHitReact::UHitReact(const FObjectInitializer& ObjectInitializer)
@@ -112,17 +223,184 @@ UHitReact::UHitReact(const FObjectInitializer& ObjectInitializer)
 	bAutoActivate = true;
 }
 
+void UHitReact::OnRegister()
+{
+	Super::OnRegister();
+
+	NetHits.OwnerComponent = this;
+
+	// Set on every net role, so components spawned on clients are set up the same as those replicated from the server
+	if (bReplicateHits && !GetIsReplicated())
+	{
+		SetIsReplicated(true);
+	}
+}
+
+void UHitReact::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bUseAsyncPhysics && FHitReactAsyncCallback::IsAvailable(GetWorld()))
+	{
+		AsyncPhysicsCallback = FHitReactAsyncCallback::Register(GetWorld());
+	}
+
+	// Allocate storage for the physics blends up front
+	if (PhysicsBlends.Num() == 0)
+	{
+		PhysicsBlendPool.Init(MaxPhysicsBlends, PhysicsBlends);
+	}
+
+	// Relays for distance culled hit reacts must reach each client before its first hit react, see BroadcastHitReact
+	if (bReplicateHits && GetOwner() && GetOwner()->HasAuthority() && GetNetMode() != NM_Standalone)
+	{
+		UHitReactClientRelay::AddToRemotePlayers(GetWorld());
+		PostLoginHandle = FGameModeEvents::GameModePostLoginEvent.AddUObject(this, &ThisClass::OnPlayerPostLogin);
+	}
+}
+
+void UHitReact::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FHitReactAsyncCallback::Unregister(GetWorld(), AsyncPhysicsCallback);
+	DiscardEnqueuedHits();
+
+	FGameModeEvents::GameModePostLoginEvent.Remove(PostLoginHandle);
+	PostLoginHandle.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UHitReact::OnPlayerPostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer)
+{
+	// Bound for every world, e.g. multiple PIE instances
+	if (IsValid(NewPlayer) && NewPlayer->GetWorld() == GetWorld() && !NewPlayer->IsLocalController())
+	{
+		UHitReactClientRelay::FindOrAdd(NewPlayer);
+	}
+}
+
+void UHitReact::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NetHits, Params);
+}
+
 #if WITH_EDITOR
 static TArray<FString> ConsumedNotifications;  // Lets not spam them
 #endif
 
+/** Maximum number of spring fallback impulses waiting for FAnimNode_HitReactSpring to consume them */
+static constexpr int32 HitReactMaxSpringImpulses = 16;
+
+namespace HitReactQueue
+{
+	/** Add to a bounded queue, once full the oldest entry is overwritten in place instead of shifting the queue */
+	static void Push(TArray<FHitReactQueuedHit>& Queue, int32& Head, FHitReactQueuedHit&& Hit, int32 MaxHits)
+	{
+		if (Queue.Num() >= FMath::Max(1, MaxHits))
+		{
+			Queue[Head] = MoveTemp(Hit);
+			Head = (Head + 1) % Queue.Num();
+			return;
+		}
+
+		Queue.Add(MoveTemp(Hit));
+	}
+
+	/** Move the queued hit reacts out, oldest first */
+	static void Take(TArray<FHitReactQueuedHit>& Queue, int32& Head, TArray<FHitReactQueuedHit>& OutHits)
+	{
+		OutHits.Reset(Queue.Num());
+		for (int32 i = 0; i < Queue.Num(); i++)
+		{
+			OutHits.Add(MoveTemp(Queue[(Head + i) % Queue.Num()]));
+		}
+		Queue.Reset();
+		Head = 0;
+	}
+
+	/** Move the queued hit reacts using the profile out, oldest first, the others remain queued in their original order */
+	static void Extract(TArray<FHitReactQueuedHit>& Queue, int32& Head, const FSoftObjectPath& ProfilePath,
+		TArray<FHitReactQueuedHit>& OutHits)
+	{
+		TArray<FHitReactQueuedHit> QueuedHits;
+		Take(Queue, Head, QueuedHits);
+
+		OutHits.Reset();
+		for (FHitReactQueuedHit& Hit : QueuedHits)
+		{
+			if (Hit.Trigger.Profile.ToSoftObjectPath() == ProfilePath)
+			{
+				OutHits.Add(MoveTemp(Hit));
+			}
+			else
+			{
+				Queue.Add(MoveTemp(Hit));
+			}
+		}
+	}
+}
+
 bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulseParams Impulse,
 	const FHitReactImpulse_WorldParams& World, float ImpulseScalar)
+{
+	return ApplyHitReact(Params, Impulse, World, ImpulseScalar, -1.f);
+}
+
+bool UHitReact::ResolveHitBones(FHitReactInputParams& Params, const FVector& HitLocation, const FVector& HitNormal,
+	float MaxDistance)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResolveHitBones);
+
+	if (!IsValid(Mesh) || Mesh->Bodies.Num() == 0)
+	{
+		return false;
+	}
+
+	// Profile and bone data that aren't loaded yet can't exclude any bones, only BlacklistedBones apply
+	const UHitReactProfile* Profile = Params.Profile.Get();
+	const TSharedPtr<const FHitReactBoneOverrides> BoneOverrides = GetBoneOverrides(Profile, Params.BoneData.Get());
+
+	// Query slightly beneath the surface, so the body that was struck is preferred over its neighbours
+	static constexpr float SurfaceDepth = 1.f;
+	const FVector QueryLocation = HitLocation - HitNormal.GetSafeNormal() * SurfaceDepth;
+
+	BodySpatialIndex.Update(Mesh->Bodies);
+	const int32 BodyIndex = BodySpatialIndex.FindNearestBody(Mesh->Bodies, QueryLocation, MaxDistance,
+		[this, &Profile, &BoneOverrides](int32 InBodyIndex)
+	{
+		if (!BoneOverrides->ExcludedBodies[InBodyIndex])
+		{
+			return true;
+		}
+
+		// Remapped bones simulate a different bone, which is validated when the hit react is applied
+		return Profile && Mesh->Bodies[InBodyIndex] &&
+			Profile->RemapSimulatedBones.Contains(UHitReactStatics::GetBoneName(Mesh, Mesh->Bodies[InBodyIndex]));
+	});
+
+	if (BodyIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// The impulse is applied where the hit landed, even if the profile remaps the simulated bone
+	const FName BoneName = UHitReactStatics::GetBoneName(Mesh, Mesh->Bodies[BodyIndex]);
+	Params.SimulatedBoneName = BoneName;
+	Params.ImpulseBoneName = BoneName;
+	return true;
+}
+
+bool UHitReact::ApplyHitReact(const FHitReactInputParams& Params, FHitReactImpulseParams Impulse,
+	const FHitReactImpulse_WorldParams& World, float ImpulseScalar, float HitTime)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReact);
 
 	// Avoid GC issues
-	if (!IsValid(GetOwner()))
+	if (!IsValid(GetOwner()) || !GetWorld())
 	{
 		return false;
 	}
@@ -133,7 +411,32 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		// DebugHitReactResult(TEXT("Dedicated server hit react disabled"), true);
 		return false;
 	}
-	
+
+	// Resolve params that were received in their compact net representation
+	if (Params.HasCompactNetIndices())
+	{
+		FHitReactInputParams ResolvedParams = Params;
+		if (!ResolveCompactNetParams(ResolvedParams))
+		{
+			DebugHitReactResult(TEXT("Failed to resolve compact net params"), true);
+			return false;
+		}
+		return ApplyHitReact(ResolvedParams, Impulse, World, ImpulseScalar, HitTime);
+	}
+
+	// Resolve a radial location that was received relative to the owner
+	if (World.bNetRadialRelative)
+	{
+		FHitReactImpulse_WorldParams ResolvedWorld = World;
+		ResolvedWorld.ResolveNetRelative(GetOwner());
+		return ApplyHitReact(Params, Impulse, ResolvedWorld, ImpulseScalar, HitTime);
+	}
+
+	// Time that has passed since the hit react was requested, non-zero when replaying queued hit reacts
+	const float TimeSeconds = GetWorld()->GetTimeSeconds();
+	HitTime = HitTime < 0.f ? TimeSeconds : FMath::Min(HitTime, TimeSeconds);
+	const float ElapsedTime = TimeSeconds - HitTime;
+
 	// Check if hit react is globally disabled
 	if (IsHitReactSystemDisabled())
 	{ 
@@ -154,13 +457,6 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		return false;
 	}
 
-	// Must have profiles loaded (async)
-	if (!bProfilesLoaded)
-	{
-		DebugHitReactResult(TEXT("Profiles not loaded"), true);
-		return false;
-	}
-
 	// Need a valid physics asset
 	if (!Mesh->GetPhysicsAsset())
 	{
@@ -175,33 +471,6 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		return false;
 	}
 
-	// Conditionally override the collision enabled state
-	if (NeedsCollisionEnabled())
-	{
-		bCollisionEnabledChanged = true;
-		DefaultCollisionEnabled = Mesh->GetCollisionEnabled();
-		switch (DefaultCollisionEnabled)
-		{
-		case ECollisionEnabled::NoCollision:
-		case ECollisionEnabled::ProbeOnly:
-			Mesh->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
-			break;
-		case ECollisionEnabled::QueryOnly:
-		case ECollisionEnabled::QueryAndProbe:
-			Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-			break;
-		default: break;
-		}
-	}
-
-	// If physics state is invalid - i.e. collision is disabled - or it does not have a valid bodies, this will crash right away
-	// Since we have done our checks and updated collision this shouldn't really be false
-	if (UNLIKELY(!Mesh->IsPhysicsStateCreated() || !Mesh->bHasValidBodies))
-	{
-		DebugHitReactResult(TEXT("Invalid Bodies"), true);
-		return false;
-	}
-
 	if (Params.Profile.IsNull())
 	{
 #if WITH_EDITOR
@@ -219,6 +488,19 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		return false;
 	}
 
+	// Must have profiles loaded (async), queue the hit react until they have if it could otherwise be applied
+	if (!bProfilesLoaded)
+	{
+		if (bQueueHitsWhileLoading)
+		{
+			QueuePendingHit(Params, Impulse, World, ImpulseScalar, HitTime);
+			DebugHitReactResult(TEXT("Profiles not loaded, hit react queued"), false);
+			return true;
+		}
+		DebugHitReactResult(TEXT("Profiles not loaded"), true);
+		return false;
+	}
+
 #if WITH_EDITOR
 	if (!AvailableProfiles.Contains(Params.Profile))
 	{
@@ -235,15 +517,17 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 #endif
 
 	// Ensure profile is loaded and available
-	TObjectPtr<const UHitReactProfile> Profile = nullptr;
-	if (Params.Profile.IsValid())
-	{
-		const TObjectPtr<const UHitReactProfile>* ProfilePtr = ActiveProfiles.FindByPredicate([&Params](const TObjectPtr<const UHitReactProfile>& InProfile)
-		{
-			return InProfile == Params.Profile.Get();
-		});
+	bool bProfilePending = false;
+	TObjectPtr<const UHitReactProfile> Profile = FindProfile(Params.Profile, bProfilePending);
 
-		Profile = ProfilePtr ? *ProfilePtr : nullptr;
+	// Profile is being lazily loaded, replay the hit react once it has loaded
+	if (bProfilePending)
+	{
+		// Queue before requesting the load, which may complete immediately and replay it
+		QueuePendingHit(Params, Impulse, World, ImpulseScalar, HitTime);
+		RequestLazyProfile(Params.Profile);
+		HIT_REACT_DEBUG_RESULTF(false, TEXT("Profile { %s } is loading, hit react queued"), *Params.Profile.ToString());
+		return true;
 	}
 
 	// Ensure bone data is loaded and available
@@ -270,31 +554,50 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 	// No valid profile found
 	if (!Profile)
 	{
-		DebugHitReactResult(FString::Printf(TEXT("Requested profile { %s } is not available"), *Params.Profile.ToString()), true);
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("Requested profile { %s } is not available"), *Params.Profile.ToString());
 		return false;
 	}
 
 	// Invalid blend params -- total time is zero
 	if (!FHitReactPhysicsState::CanActivate(Profile->BlendParams))
 	{
-		DebugHitReactResult(FString::Printf(TEXT("Blend params for profile { %s } are invalid"), *Params.Profile.ToString()), true);
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("Blend params for profile { %s } are invalid"), *Params.Profile.ToString());
+		return false;
+	}
+
+	// Queued hit react would already have completed
+	if (ElapsedTime >= Profile->BlendParams.GetTotalTime())
+	{
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("Queued hit react for profile { %s } expired before it could be applied"), *Params.Profile.ToString());
 		return false;
 	}
 
-	// Don't apply hit react if the LOD threshold is not met
+	// Don't apply hit react if the LOD threshold is not met, unless we can react in the anim graph instead
+	bool bSpringFallback = false;
 	if (Profile->LODThreshold >= 0)
 	{
 		if (Mesh->GetPredictedLODLevel() > Profile->LODThreshold)
 		{
-			DebugHitReactResult(FString::Printf(TEXT("LOD threshold not met for profile { %s }"), *Params.Profile.ToString()), true);
-			return false;
+			if (!Profile->bSpringFallback || !Impulse.CanBeApplied())
+			{
+				HIT_REACT_DEBUG_RESULTF(true, TEXT("LOD threshold not met for profile { %s }"), *Params.Profile.ToString());
+				return false;
+			}
+			bSpringFallback = true;
 		}
 	}
 
+	// Don't apply hit reacts that no local viewer can see
+	if (IsCulledForLocalViewers(Profile))
+	{
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("Culled for local viewers for profile { %s }"), *Params.Profile.ToString());
+		return false;
+	}
+
 	// Throttle hit reacts to prevent rapid application
 	if (Cooldown > 0.f && LastHitReactTime >= 0.f)
 	{
-		if (GetWorld()->TimeSince(LastHitReactTime) < Cooldown)
+		if (HitTime - LastHitReactTime < Cooldown)
 		{
 			return false;
 		}
@@ -304,105 +607,74 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 	float& LastProfileTime = LastProfileHitReactTimes.FindOrAdd(Profile);
 	if (Profile->Cooldown > 0.f)
 	{
-		if (GetWorld()->TimeSince(LastProfileTime) < Profile->Cooldown)
+		if (HitTime - LastProfileTime < Profile->Cooldown)
 		{
 			return false;
 		}
 	}
 
-	// Apply the constraint profile to the mesh
-	if (!Profile->ConstraintProfile.IsNone())
-	{
-		bConstraintProfileChanged = true;
-		Mesh->SetConstraintProfileForAll(Profile->ConstraintProfile);
-	}
-		
-	// Optionally don't apply hit react if we have reached the maximum number of active hit reacts
-	switch (Profile->MaxBlendHandling)
+	// React in the anim graph, without simulating physics
+	if (bSpringFallback)
 	{
-	case EHitReactMaxBlendHandling::Disabled:
-		break;
-	case EHitReactMaxBlendHandling::ImpulseOnly:
-		if (PhysicsBlends.Num() >= Profile->MaxActiveBlends)
+		// Each impulse lives in the slot for its serial, once full the oldest is overwritten in place
+		const FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? Params.SimulatedBoneName : Params.ImpulseBoneName;
+		FHitReactPendingImpulse SpringImpulse(Impulse, World, ImpulseScalar, Profile, ImpulseBoneName);
+		if (SpringImpulses.Num() >= HitReactMaxSpringImpulses)
 		{
-			// Apply physics impulse on next tick
-			if (Impulse.CanBeApplied())
-			{
-				FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? Params.SimulatedBoneName : Params.ImpulseBoneName;
-				PendingImpulse = FHitReactPendingImpulse{ Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
-			}
+			SpringImpulses[NumSpringImpulses % HitReactMaxSpringImpulses] = MoveTemp(SpringImpulse);  // Every anim node has had a chance to read it by now
+		}
+		else
+		{
+			SpringImpulses.Add(MoveTemp(SpringImpulse));
+		}
+		NumSpringImpulses++;
 
-			// Track the last hit react time
-			LastHitReactTime = GetWorld()->GetTimeSeconds();
-			LastProfileTime = LastHitReactTime;
+		// Track the last hit react time
+		LastHitReactTime = HitTime;
+		LastProfileTime = LastHitReactTime;
 
-			// Print the result
-			DebugHitReactResult(TEXT("Applied impulse only"), false);
-			
-			return true;  // Not sure what to return here, but this seems to be the most appropriate
-		}
-		break;
-	case EHitReactMaxBlendHandling::Blocked:
-		if (PhysicsBlends.Num() >= Profile->MaxActiveBlends)
+		// Capture for offline replay
+		if (FHitReactRecorder::IsRecording())
 		{
-			return false;
+			FHitReactRecorder::Get().Record(this, Params, Impulse, World, ImpulseScalar, HitTime);
 		}
-		break;
+
+		HIT_REACT_DEBUG_RESULTF(false, TEXT("Applied spring fallback beyond LOD threshold for profile { %s }"), *Params.Profile.ToString());
+		return true;
 	}
 
-	// Gather disabled bones and their descendents
-	TArray<FName> DisabledBones = {};
-	TMap<FName, float> BoneWeightScalars = {};
-	TMap<FName, FHitReactBoneOverride> BoneOverrides = Profile->BoneOverrides;
-	if (BoneData)
+	// Conditionally override the collision enabled state, only once nothing else can reject the hit react
+	if (NeedsCollisionEnabled())
 	{
-		// Append BoneOverrides with optional BoneData overrides
-		for (const auto& Pair : BoneData->BoneOverrides)
-		{
-			// If an override exists already, take the higher BlendWeightScalar, and if either disables physics, disable physics
-			const FName& BoneName = Pair.Key;
-			const FHitReactBoneOverride& Override = Pair.Value;
-			FHitReactBoneOverride& ExistingOverride = BoneOverrides.FindOrAdd(BoneName);
-			if (Override.bDisablePhysics)
-			{
-				ExistingOverride.bDisablePhysics = true;
-			}
-			ExistingOverride.BlendWeightScalar = FMath::Max(ExistingOverride.BlendWeightScalar, Override.BlendWeightScalar);
-		}
+		EnablePhysicsCollision();
 	}
-	for (const auto& Pair : BoneOverrides)
+
+	// If physics state is invalid - i.e. collision is disabled - or it does not have a valid bodies, this will crash right away
+	// Since we have done our checks and updated collision this shouldn't really be false
+	if (UNLIKELY(!Mesh->IsPhysicsStateCreated() || !Mesh->bHasValidBodies))
 	{
-		const FName& BoneName = Pair.Key;
-		const FHitReactBoneOverride& Override = Pair.Value;
-		if (Override.bDisablePhysics || Override.BlendWeightScalar < 1.f)
+		if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
 		{
-			// Iterate all descendents
-			UHitReactStatics::ForEach(Mesh, BoneName, Override.bIncludeSelf,
-				[this, &Override, &DisabledBones, &BoneWeightScalars](const FBodyInstance* BI)
-			{
-				const FName ChildBoneName = UHitReactStatics::GetBoneName(Mesh, BI);
-					
-				// Disable all descendents
-				if (Override.bDisablePhysics)
-				{
-					DisabledBones.Add(ChildBoneName);
-				}
-
-				// Limit the blend weight for all descendents
-				if (Override.BlendWeightScalar < 1.f)
-				{
-					BoneWeightScalars.Add(ChildBoneName, Override.BlendWeightScalar);
-				}
-
-				// Continue to the next bone
-				return true;
-			});
+			RestoreCollisionEnabled();
 		}
+		DebugHitReactResult(TEXT("Invalid Bodies"), true);
+		return false;
+	}
+
+	// Storage for the physics blends is normally allocated in BeginPlay
+	if (PhysicsBlendPool.GetCapacity() == 0)
+	{
+		PhysicsBlendPool.Init(MaxPhysicsBlends, PhysicsBlends);
 	}
 
+	// Gather disabled bodies, and the body each bone resolves to
+	const TSharedPtr<const FHitReactBoneOverrides> BoneOverrides = GetBoneOverrides(Profile, BoneData);
+
 	// Apply the hit react to the first bone below the specified bone that is valid
 	bool bApplied = false;
-	bool bAppliedProfile = false;
+	bool bMerged = false;
+	bool bPoolFull = false;
+	bool bMaxActiveBlends = false;  // Blocked or impulse only, see EHitReactMaxBlendHandling
 	FName StartingBone = Params.SimulatedBoneName;  // First bone that was valid and applied to
 	if (const FName* RemapBoneName = Profile->RemapSimulatedBones.Find(StartingBone))
 	{
@@ -411,59 +683,132 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 		StartingBone = *RemapBoneName;
 	}
 	FName SimulatedBoneName = NAME_None;  // First bone that was valid and applied to
-	UHitReactStatics::ForEach(Mesh, StartingBone, Params.bIncludeSelf,
-		[this, &Profile, &bAppliedProfile, &Params, &bApplied, &DisabledBones, &BoneWeightScalars, &SimulatedBoneName]
-		(const FBodyInstance* BI)
+
+	// The first valid body at or below the bone is precomputed, skipping blacklisted and disabled bones
+	const int32 StartingBoneIndex = StartingBone.IsNone() ? INDEX_NONE : Mesh->GetBoneIndex(StartingBone);
+	const int32 SimulatedBodyIndex = StartingBone.IsNone() || StartingBoneIndex != INDEX_NONE ?
+		BoneOverrides->FindSimulatedBody(StartingBoneIndex, Params.bIncludeSelf) : INDEX_NONE;
+	if (const FBodyInstance* BI = Mesh->Bodies.IsValidIndex(SimulatedBodyIndex) ? Mesh->Bodies[SimulatedBodyIndex] : nullptr)
 	{
 		// Determine the bone name to Simulate
 		const FName BoneName = UHitReactStatics::GetBoneName(Mesh, BI);
-		if (BlacklistedBones.Contains(BoneName))
-		{
-			// Don't simulate this bone
-			return true;  // Continue to the next bone
-		}
 
-		// Don't simulate disabled bones
-		if (DisabledBones.Contains(BoneName))
-		{
-			// Don't simulate this bone
-			return true;  // Continue to the next bone
-		}
+		// Refresh the active physics blend for this bone and profile in place, instead of adding another
+		bMerged = MergePhysicsBlend(BoneName, Profile);
 
-		// Apply the animation profile to the first valid bone
-		if (!bAppliedProfile)
+		// Only hit reacts that require a new physics blend are subject to the maximum number of active hit reacts
+		if (!bMerged && PhysicsBlends.Num() >= Profile->MaxActiveBlends)
 		{
-			bAppliedProfile = true;
-			if (PhysicalAnimation && !Profile->PhysicalAnimProfile.IsNone())
+			switch (Profile->MaxBlendHandling)
 			{
-				bPhysicalAnimationProfileChanged = true;
-				PhysicalAnimation->ApplyPhysicalAnimationProfileBelow(BoneName, Profile->PhysicalAnimProfile, Params.bIncludeSelf);
+			case EHitReactMaxBlendHandling::Disabled:
+				break;
+			case EHitReactMaxBlendHandling::ImpulseOnly:
+			case EHitReactMaxBlendHandling::Blocked:
+				bMaxActiveBlends = true;
+				break;
+			case EHitReactMaxBlendHandling::ReplaceOldest:
+			case EHitReactMaxBlendHandling::ReplaceLowestWeight:
+			case EHitReactMaxBlendHandling::ReplaceFurthestBlendOut:
+				EvictPhysicsBlend(Profile->MaxBlendHandling);
+				break;
 			}
 		}
+		else if (!bMerged && PhysicsBlendPool.IsFull())
+		{
+			// Make room for the new physics blend
+			EvictPhysicsBlend(Profile->MaxBlendHandling);
+		}
 
-		// Console command: Log LogHitReact VeryVerbose
-		UE_LOG(LogHitReact, VeryVerbose, TEXT("Simulating bone %s"), *BoneName.ToString());
-
-		// Apply the hit react to the bone
-		FHitReactPhysics& Physics = PhysicsBlends.Add_GetRef({});
-		Physics.HitReact(Mesh, Profile, BoneName, DisabledBones, BoneWeightScalars);
-
-		// Output the resulting bone
-		bApplied = true;
-		SimulatedBoneName = BoneName;
-		return false;  // Stop iterating
-	});
+		if (bMerged)
+		{
+			bApplied = true;
+			SimulatedBoneName = BoneName;
+		}
+		else if (bMaxActiveBlends)
+		{
+			// Impulse only hit reacts are applied below
+			SimulatedBoneName = BoneName;
+		}
+		else if (PhysicsBlendPool.IsFull())
+		{
+			// No storage available for another physics blend
+			bPoolFull = true;
+		}
+		else
+		{
+			// Apply the animation profile to the simulated bone
+			if (PhysicalAnimation && !Profile->PhysicalAnimProfile.IsNone())
+			{
+				bPhysicalAnimationProfileChanged = true;
+				PhysicalAnimation->ApplyPhysicalAnimationProfileBelow(BoneName, Profile->PhysicalAnimProfile, Params.bIncludeSelf);
+			}
+
+			// Apply the constraint profile to the simulated bones only
+			if (!Profile->ConstraintProfile.IsNone())
+			{
+				ApplyConstraintProfileBelow(BoneName, Profile->ConstraintProfile);
+			}
+
+			// Console command: Log LogHitReact VeryVerbose
+			UE_LOG(LogHitReact, VeryVerbose, TEXT("Simulating bone %s"), *BoneName.ToString());
+
+			// Apply the hit react to the bone
+			const int32 BlendIndex = PhysicsBlends.Num();
+			FHitReactPhysics& Physics = PhysicsBlends.Add_GetRef({});
+			Physics.HitReact(Profile, BoneName, BoneOverrides);
+			Physics.Handle = PhysicsBlendPool.Allocate(BlendIndex);
+			BoneBlendRateSum += Profile->BoneBlendRate;
+
+			// Fast-forward queued hit reacts to the point in the blend they would have reached
+			if (ElapsedTime > 0.f)
+			{
+				Physics.PhysicsState.SetElapsedTime(ElapsedTime);
+			}
+			bBlendEvaluatorDirty = true;
+
+			// Output the resulting bone
+			bApplied = true;
+			SimulatedBoneName = BoneName;
+		}
+	}
+
+	// Apply only the impulse if we have reached the maximum number of active hit reacts
+	if (bMaxActiveBlends && Profile->MaxBlendHandling == EHitReactMaxBlendHandling::ImpulseOnly)
+	{
+		// Apply physics impulse on next tick
+		if (Impulse.CanBeApplied())
+		{
+			FName ImpulseBoneName = Params.ImpulseBoneName.IsNone() ? SimulatedBoneName : Params.ImpulseBoneName;
+			PendingImpulse = FHitReactPendingImpulse{ Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
+		}
+
+		// Collision responses are ignored between hit reacts while the physics state is warm
+		RestoreCollisionResponses();
+
+		// Track the last hit react time
+		LastHitReactTime = HitTime;
+		LastProfileTime = LastHitReactTime;
+
+		// Capture for offline replay
+		if (FHitReactRecorder::IsRecording())
+		{
+			FHitReactRecorder::Get().Record(this, Params, Impulse, World, ImpulseScalar, HitTime);
+		}
+
+		// Print the result
+		DebugHitReactResult(TEXT("Applied impulse only"), false);
+
+		return true;  // Not sure what to return here, but this seems to be the most appropriate
+	}
 
 	if (bApplied)
 	{
-		// This is necessary because we need to process parent bones before we can process child bones
-		// A child bone must continue to simulate if the parent bone has any blend weight
-		PhysicsBlends.Sort([this](const FHitReactPhysics& A, const FHitReactPhysics& B)
+		// Batches sort once they have been applied, merged physics blends are already sorted
+		if (!bDeferBlendSort && !bMerged)
 		{
-			const int32 AIndex = Mesh->GetBoneIndex(A.SimulatedBoneName);
-			const int32 BIndex = Mesh->GetBoneIndex(B.SimulatedBoneName);
-			return AIndex < BIndex;
-		});
+			SortPhysicsBlends();
+		}
 	
 		// Apply physics impulse on next tick
 		if (Impulse.CanBeApplied())
@@ -472,16 +817,41 @@ bool UHitReact::HitReact(const FHitReactInputParams& Params, FHitReactImpulsePar
 			PendingImpulse = { Impulse, World, ImpulseScalar, Profile, ImpulseBoneName };
 		}
 
+		// Collision responses are ignored between hit reacts while the physics state is warm
+		RestoreCollisionResponses();
+
 		// Wake up the hit react system
 		WakeHitReact();
 
 		// Track the last hit react time
-		LastHitReactTime = GetWorld()->GetTimeSeconds();
+		LastHitReactTime = HitTime;
 		LastProfileTime = LastHitReactTime;
+
+		// Capture for offline replay
+		if (FHitReactRecorder::IsRecording())
+		{
+			FHitReactRecorder::Get().Record(this, Params, Impulse, World, ImpulseScalar, HitTime);
+		}
+	}
+	else if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
+	{
+		// Nothing will tick to restore the collision enabled state for us
+		RestoreCollisionEnabled();
 	}
 	
 	// Print the result
-	DebugHitReactResult(bApplied ? TEXT("Hit react applied") : TEXT("Hit react failed to apply"), !bApplied);
+	if (bPoolFull)
+	{
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("MaxPhysicsBlends { %d } reached for profile { %s }"), MaxPhysicsBlends, *Params.Profile.ToString());
+	}
+	else if (bMaxActiveBlends)
+	{
+		HIT_REACT_DEBUG_RESULTF(true, TEXT("MaxActiveBlends { %d } reached for profile { %s }"), Profile->MaxActiveBlends, *Params.Profile.ToString());
+	}
+	else
+	{
+		DebugHitReactResult(bMerged ? TEXT("Hit react merged") : bApplied ? TEXT("Hit react applied") : TEXT("Hit react failed to apply"), !bApplied);
+	}
 
 	return bApplied;
 }
@@ -516,6 +886,134 @@ bool UHitReact::HitReactTrigger_Radial(const FHitReactTrigger_Radial& Params, co
 	return HitReact(Params, ImpulseParams, World, ImpulseScalar);
 }
 
+static const FReferenceSkeleton* GetHitReactRefSkeleton(const USkeletalMeshComponent* SkelMesh)
+{
+	const USkeletalMesh* MeshAsset = SkelMesh ? SkelMesh->GetSkeletalMeshAsset() : nullptr;
+	const USkeleton* Skeleton = MeshAsset ? MeshAsset->GetSkeleton() : nullptr;
+	return Skeleton ? &Skeleton->GetReferenceSkeleton() : nullptr;
+}
+
+void UHitReact::MakeCompactNetParams(FHitReactInputParams& Params) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::MakeCompactNetParams);
+
+	Params.ResetCompactNetIndices();
+
+	// Indices come from the class defaults so they are deterministic across the network
+	const UHitReact* Defaults = GetClass()->GetDefaultObject<UHitReact>();
+
+	const int32 ProfileIndex = Defaults->AvailableProfiles.IndexOfByKey(Params.Profile);
+	if (ProfileIndex != INDEX_NONE && ProfileIndex <= MAX_int16)
+	{
+		Params.NetProfileIndex = static_cast<int16>(ProfileIndex);
+	}
+
+	if (!Params.BoneData.IsNull())
+	{
+		const int32 BoneDataIndex = Defaults->AvailableBoneData.IndexOfByKey(Params.BoneData);
+		if (BoneDataIndex != INDEX_NONE && BoneDataIndex <= MAX_int16)
+		{
+			Params.NetBoneDataIndex = static_cast<int16>(BoneDataIndex);
+		}
+	}
+
+	// Mesh is not cached on dedicated servers, where the system is typically never activated
+	const USkeletalMeshComponent* SkelMesh = Mesh ? Mesh.Get() : GetMeshFromOwner();
+	const FReferenceSkeleton* RefSkeleton = GetHitReactRefSkeleton(SkelMesh);
+	if (!RefSkeleton || Params.SimulatedBoneName.IsNone() || RefSkeleton->GetNum() > MAX_int16)
+	{
+		return;
+	}
+
+	const int32 SimulatedBoneIndex = RefSkeleton->FindBoneIndex(Params.SimulatedBoneName);
+	const int32 ImpulseBoneIndex = Params.ImpulseBoneName.IsNone() ? INDEX_NONE :
+		RefSkeleton->FindBoneIndex(Params.ImpulseBoneName);
+
+	// Fall back to names unless every bone could be converted
+	if (SimulatedBoneIndex != INDEX_NONE && (Params.ImpulseBoneName.IsNone() || ImpulseBoneIndex != INDEX_NONE))
+	{
+		Params.NetNumBones = static_cast<uint16>(RefSkeleton->GetNum());
+		Params.NetSimulatedBoneIndex = static_cast<int16>(SimulatedBoneIndex);
+		Params.NetImpulseBoneIndex = static_cast<int16>(ImpulseBoneIndex);
+	}
+}
+
+FHitReactTrigger UHitReact::MakeCompactTrigger(const FHitReactTrigger& Trigger) const
+{
+	FHitReactTrigger CompactTrigger = Trigger;
+	MakeCompactNetParams(CompactTrigger);
+	return CompactTrigger;
+}
+
+FHitReactImpulse_WorldParams UHitReact::MakeCompactWorldParams(const FHitReactImpulse_WorldParams& World,
+	const FHitReactImpulseParams& Impulse) const
+{
+	FHitReactImpulse_WorldParams CompactWorld = World;
+	CompactWorld.MakeNetPacked(Impulse, GetOwner());
+	return CompactWorld;
+}
+
+bool UHitReact::ResolveCompactNetParams(FHitReactInputParams& Params) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResolveCompactNetParams);
+
+	const UHitReact* Defaults = GetClass()->GetDefaultObject<UHitReact>();
+	bool bResolved = true;
+
+	if (Params.NetProfileIndex != INDEX_NONE)
+	{
+		if (Defaults->AvailableProfiles.IsValidIndex(Params.NetProfileIndex))
+		{
+			Params.Profile = Defaults->AvailableProfiles[Params.NetProfileIndex];
+		}
+		else
+		{
+			bResolved = false;
+		}
+	}
+
+	if (Params.NetBoneDataIndex != INDEX_NONE)
+	{
+		if (Defaults->AvailableBoneData.IsValidIndex(Params.NetBoneDataIndex))
+		{
+			Params.BoneData = Defaults->AvailableBoneData[Params.NetBoneDataIndex];
+		}
+		else
+		{
+			bResolved = false;
+		}
+	}
+
+	if (Params.NetSimulatedBoneIndex != INDEX_NONE)
+	{
+		// The bone count must match the sender's, otherwise the skeletons differ and the indices are meaningless
+		const USkeletalMeshComponent* SkelMesh = Mesh ? Mesh.Get() : GetMeshFromOwner();
+		const FReferenceSkeleton* RefSkeleton = GetHitReactRefSkeleton(SkelMesh);
+		if (RefSkeleton && RefSkeleton->GetNum() == Params.NetNumBones && RefSkeleton->IsValidIndex(Params.NetSimulatedBoneIndex))
+		{
+			Params.SimulatedBoneName = RefSkeleton->GetBoneName(Params.NetSimulatedBoneIndex);
+			if (Params.NetImpulseBoneIndex != INDEX_NONE)
+			{
+				if (RefSkeleton->IsValidIndex(Params.NetImpulseBoneIndex))
+				{
+					Params.ImpulseBoneName = RefSkeleton->GetBoneName(Params.NetImpulseBoneIndex);
+				}
+				else
+				{
+					bResolved = false;
+				}
+			}
+		}
+		else
+		{
+			bResolved = false;
+		}
+	}
+
+	Params.ResetCompactNetIndices();
+	return bResolved;
+}
+
 void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::TickComponent);
@@ -526,6 +1024,7 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 	if (!CanHitReact())
 	{
 		ResetHitReactSystem();
+		DiscardEnqueuedHits();
 		SleepHitReact();
 		PendingImpulse = {};
 		return;
@@ -533,10 +1032,14 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 
 	// Tick the global toggle state
 	TickGlobalToggle(DeltaTime);
+
+	// Apply hit reacts queued from other threads
+	ApplyEnqueuedHits();
 	
-	if (PhysicsBlends.Num() == 0)
+	if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
 	{
-		if (ShouldSleep() && !IsSleeping())
+		// Don't sleep while another thread is still queueing a hit react, it won't wake us
+		if (ShouldSleep() && !IsSleeping() && NumEnqueuedHits.load() == 0)
 		{
 			// Disable tick
 			SleepHitReact();
@@ -551,131 +1054,166 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 	}
 	
 #if UE_ENABLE_DEBUG_DRAWING
-	FString DebugBlendWeightString = "";
-	const bool bDebugPhysicsBlendWeights = ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactBlendWeights);
-	
-	const bool bDebugPhysicsBoneWeights = ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactBoneWeights);
-	FString DebugBoneWeightString = "";
+	// Debug text is built on the stack, and only while enabled
+	const uint8 ActiveDebugFlags = GetDebugFlags();
+	const bool bDebugPhysicsBlendWeights = (ActiveDebugFlags & HitReactDebug::BlendWeights) != 0;
+	const bool bDebugPhysicsBoneWeights = (ActiveDebugFlags & HitReactDebug::BoneWeights) != 0;
+	TStringBuilder<1024> DebugBlendWeightString;
+	TStringBuilder<1024> DebugBoneWeightString;
 #endif
 
-	// Accumulate final blend weights per bone
-	TMap<FName, float> AccumulatedBoneWeights;
+	// The physics blends were resolved against the bodies of the previous assets
+	if (ResetIfBodyAssetsChanged())
+	{
+		return;
+	}
+
+	// Bodies may have changed, e.g. they were recreated without physics
+	// Resize rather than reset, so bodies that are still simulating remain tracked until they are switched back
+	if (BodySimStates.Num() != Mesh->Bodies.Num())
+	{
+		BodySimStates.SetNum(Mesh->Bodies.Num());
+		BoneOverridesCache.Reset();
+	}
 
 	// Scale the blend rate by the global alpha
 	const float GlobalAlpha = GlobalToggle.State.GetBlendStateAlpha();
 
-	// Average the blend rates of each profile
-	float BoneBlendRate = 0.f;
-	for (const FHitReactPhysics& Physics : PhysicsBlends)
-	{
-		BoneBlendRate += Physics.Profile->BoneBlendRate;
-	}
-	BoneBlendRate /= FMath::Max(1, PhysicsBlends.Num());
+	// Average the blend rates of each profile, or blend each body at its own rate
+	const bool bPerBodyBlendRate = BoneBlendRateMode == EHitReactBoneBlendRate::PerBody;
+	const float BoneBlendRate = BoneBlendRateSum / FMath::Max(1, PhysicsBlends.Num());
 
-	// Tick each physics blend and accumulate the blend weights
-	PhysicsBlends.RemoveAll([this, DeltaTime, &GlobalAlpha, &AccumulatedBoneWeights, &BoneBlendRate
-#if UE_ENABLE_DEBUG_DRAWING
-		, &DebugBlendWeightString, &bDebugPhysicsBlendWeights
-#endif
-		](FHitReactPhysics& Physics)
+	// Evaluate the blend weight of each physics blend
+	if (bBlendEvaluatorDirty || BlendEvaluator.Num() != PhysicsBlends.Num())
 	{
-		// Cache the previous blend weight
-		const float LastBlendWeight = Physics.RequestedBlendWeight;
+		BlendEvaluator.Build(PhysicsBlends);
+		bBlendEvaluatorDirty = false;
+	}
+	BlendEvaluator.Evaluate(DeltaTime, PhysicsBlends);
 
-		// Update the physics blend
-		Physics.Tick(DeltaTime);
+	// Blend in new weights smoothly
+	BodyBlendWeights.Begin(Mesh->Bodies, DeltaTime, bPerBodyBlendRate, BoneBlendRate);
 
-		bool bShouldRemove = Physics.HasCompleted();
-		
-		// Accumulate the blend weights for each bone
-		UHitReactStatics::ForEach(Mesh, Physics.SimulatedBoneName, true,
-	[this, DeltaTime, &Physics, &LastBlendWeight, &GlobalAlpha, &AccumulatedBoneWeights, &bShouldRemove, &BoneBlendRate]
-			(const FBodyInstance* BI)
+	// Gather the blend weight each physics blend requests for each of its bodies
+	for (const FHitReactPhysics& Physics : PhysicsBlends)
+	{
+		BodyBlendWeights.BeginBlend();
+		UHitReactStatics::ForEach(Mesh, Physics.SimulatedBoneName, true, [this, &Physics, &GlobalAlpha](const FBodyInstance* BI)
 		{
-			const FName BoneName = UHitReactStatics::GetBoneName(Mesh, BI);
-			if (Physics.DisabledBones.Contains(BoneName))
+			const int32 BodyIndex = BI->InstanceBodyIndex;
+			if (Physics.IsBodyDisabled(BodyIndex))
 			{
 				// Don't simulate this bone
 				return true;  // Continue to the next bone
 			}
 
-			// Get the current blend weight for this bone
-			if (!AccumulatedBoneWeights.Contains(BoneName))
-			{
-				AccumulatedBoneWeights.Add(BoneName, UHitReactStatics::GetBoneBlendWeight(Mesh, BoneName));
-			}
-	
-			// Apply decay so old reactions smoothly reduce their influence
-			float& AccumulatedWeight = AccumulatedBoneWeights.FindChecked(BoneName);
-		
-			// Scale blend weight per-bone
-			const float BoneBlendWeightScalar = Physics.BoneWeightScalars.Contains(BoneName) ? Physics.BoneWeightScalars[BoneName] : 1.f;
-			const float AppliedBlendWeight = Physics.RequestedBlendWeight * BoneBlendWeightScalar;
-		
-			// Blend in new weight smoothly
-			AccumulatedWeight = FMath::Lerp(AccumulatedWeight, AppliedBlendWeight, 1.f - FMath::Exp(-BoneBlendRate * DeltaTime));
-
-			// Clamp to 0-1
-			AccumulatedWeight = FMath::Clamp(AccumulatedWeight, 0.f, 1.f);
+			TouchBodySimState(BI, Physics.Profile);
 
-			// Delay removal until weight is nearly zero**
-			if (!FMath::IsNearlyZero(AccumulatedWeight, 0.01f))
-			{
-				bShouldRemove = false;
-			}
+			// Scale blend weight per-bone
+			BodyBlendWeights.AddTarget(BodyIndex, Physics.RequestedBlendWeight * Physics.GetBodyWeightScalar(BodyIndex),
+				Physics.Profile->BoneBlendRate);
 
 			return true;  // Continue to the next bone
 		});
+	}
+
+	// Simulating bodies no physics blend touched, e.g. because their physics blend was evicted, blend out instead of
+	// snapping to kinematic, these are gathered after every physics blend so the blend indices are unaffected
+	BodyBlendWeights.BeginBlend();
+	for (int32 BodyIndex = 0; BodyIndex < BodySimStates.Num(); BodyIndex++)
+	{
+		FHitReactBodySimState& SimState = BodySimStates[BodyIndex];
+		const FBodyInstance* BI = SimState.bTracked && SimState.LastTouchedSerial != SimStateSerial ? Mesh->Bodies[BodyIndex] : nullptr;
+		if (BI && BI->bSimulatePhysics && BI->PhysicsBlendWeight > 0.f)
+		{
+			SimState.LastTouchedSerial = SimStateSerial;
+			BodyBlendWeights.AddTarget(BodyIndex, 0.f, SimState.BlendRate);
+		}
+	}
 
+	// Smooth and clamp the blend weight of every body
+	BodyBlendWeights.Resolve();
+
+	// Remove completed physics blends
+	int32 BlendIndex = 0;
+	PhysicsBlends.RemoveAll([this, &BlendIndex
+#if UE_ENABLE_DEBUG_DRAWING
+		, &DebugBlendWeightString, &bDebugPhysicsBlendWeights
+#endif
+		](const FHitReactPhysics& Physics)
+	{
 #if UE_ENABLE_DEBUG_DRAWING
 		// Debug drawing for blend weights
 		if (bDebugPhysicsBlendWeights)
 		{
 			if (Physics.IsActive())
 			{
-				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ] %.2f\n"), *Physics.SimulatedBoneName.ToString(),
+				DebugBlendWeightString.Appendf(TEXT("%s: [ %s ] %.2f\n"), *Physics.SimulatedBoneName.ToString(),
 					*Physics.PhysicsState.GetBlendStateString(), Physics.PhysicsState.GetBlendStateAlpha());
 			}
 			else
 			{
-				DebugBlendWeightString += FString::Printf(TEXT("%s: [ %s ]\n"), *Physics.SimulatedBoneName.ToString(),
+				DebugBlendWeightString.Appendf(TEXT("%s: [ %s ]\n"), *Physics.SimulatedBoneName.ToString(),
 					*Physics.PhysicsState.GetBlendStateString());
 			}
 		}
 #endif
-		
-		return bShouldRemove;
+
+		// Delay removal until the weight of each body is nearly zero
+		const bool bHasBlendWeight = BodyBlendWeights.HasBlendWeight(BlendIndex++, 0.01f);
+		if (Physics.HasCompleted() && !bHasBlendWeight)
+		{
+			PhysicsBlendPool.Release(Physics.Handle);
+			BoneBlendRateSum -= Physics.Profile->BoneBlendRate;
+			return true;
+		}
+		return false;
 	});
+	if (PhysicsBlends.Num() != BlendIndex)
+	{
+		PhysicsBlendPool.Remap(PhysicsBlends);
+	}
+
+	// Clear any floating point drift once there is nothing left to average
+	if (PhysicsBlends.Num() == 0)
+	{
+		BoneBlendRateSum = 0.f;
+	}
 
-	// Apply the final accumulated blend weights
-	for (const auto& Pair : AccumulatedBoneWeights)
+	// Apply the final blend weights to the bodies touched this tick, the simulate state is changed afterward in a single pass
+	for (int32 BodyIndex = 0; BodyIndex < BodySimStates.Num(); BodyIndex++)
 	{
-		UHitReactStatics::SetBlendWeight(Mesh, Pair.Key, Pair.Value);
+		FBodyInstance* BI = Mesh->Bodies[BodyIndex];
+		if (!BI || BodySimStates[BodyIndex].LastTouchedSerial != SimStateSerial)
+		{
+			continue;
+		}
+
+		const float BlendWeight = BodyBlendWeights.GetBlendWeight(BodyIndex);
+		UHitReactStatics::ApplyBlendWeight(BI, BlendWeight);
 
 #if UE_ENABLE_DEBUG_DRAWING
 		// Debug drawing for per-bone weights
 		if (bDebugPhysicsBoneWeights)
 		{
-			const FName& BoneName = Pair.Key;
-			DebugBoneWeightString += FString::Printf(TEXT("%s: %.2f\n"), *BoneName.ToString(), Pair.Value);
+			const FName BoneName = UHitReactStatics::GetBoneName(Mesh, BI);
+			DebugBoneWeightString.Appendf(TEXT("%s: %.2f\n"), *BoneName.ToString(), BlendWeight);
 		}
 #endif
 	}
 
-	// Restore our Mesh if all physics blends have been completed
-	if (PhysicsBlends.Num() == 0)
+	ApplySimulateFlips();
+
+	// Restore our Mesh if all physics blends have been completed and no bodies are simulating
+	if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
 	{
-		// Restore the collision enabled state
-		if (bCollisionEnabledChanged)
-		{
-			Mesh->SetCollisionEnabled(DefaultCollisionEnabled);
-			bCollisionEnabledChanged = false;
-		}
+		// Restore the collision enabled state, unless we're keeping the physics state warm
+		RestoreCollisionEnabled();
 
 		// Remove the constraint profile
 		if (bConstraintProfileChanged)
 		{
-			Mesh->SetConstraintProfileForAll(FName(NAME_None));
+			ResetConstraintProfiles();
 			bConstraintProfileChanged = false;
 		}
 
@@ -687,8 +1225,12 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 		}
 	}
 
-	// Finalize the physics simulation for the mesh
-	UHitReactStatics::FinalizeMeshPhysics(Mesh);
+	// Finalize the physics simulation for the mesh, only required when the simulated or weighted bodies changed
+	if (bMeshPhysicsDirty)
+	{
+		UHitReactStatics::FinalizeMeshPhysics(Mesh, NumWeightedBodies);
+		bMeshPhysicsDirty = false;
+	}
 
 	if (PendingImpulse.IsValid())
 	{
@@ -699,26 +1241,25 @@ void UHitReact::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorC
 	// Draw debug strings if desired
 #if UE_ENABLE_DEBUG_DRAWING
 	// Number of hit reacts
-	if (ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactNum))
+	const bool bDebugNum = (ActiveDebugFlags & HitReactDebug::Count) != 0;
+	if (bDebugNum)
 	{
 		GEngine->AddOnScreenDebugMessage(GetUniqueDrawDebugKey(901), DeltaTime * 2.f, FColor::Yellow, FString::Printf(TEXT("Num Hit Reacts: %d"), PhysicsBlends.Num()));
 	}
 
 	// Blend weight text
-	if (bDebugPhysicsBlendWeights && !DebugBlendWeightString.IsEmpty())
+	if (bDebugPhysicsBlendWeights && DebugBlendWeightString.Len() > 0)
 	{
 		// If not drawing the number of hit reacts, prepend the number of hit reacts to the blend weight string
-		if (!ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactNum))
-		{
-			DebugBlendWeightString = FString::Printf(TEXT("Blend Weights: %d\n"), PhysicsBlends.Num()) + DebugBlendWeightString;
-		}
-		GEngine->AddOnScreenDebugMessage(GetUniqueDrawDebugKey(692), DeltaTime * 2.f, FColor::Orange, DebugBlendWeightString);
+		const FString BlendWeightText = bDebugNum ? FString(DebugBlendWeightString.ToView()) :
+			FString::Printf(TEXT("Blend Weights: %d\n%s"), PhysicsBlends.Num(), *DebugBlendWeightString);
+		GEngine->AddOnScreenDebugMessage(GetUniqueDrawDebugKey(692), DeltaTime * 2.f, FColor::Orange, BlendWeightText);
 	}
 
 	// Per-Bone weight text
-	if (bDebugPhysicsBoneWeights && !DebugBoneWeightString.IsEmpty())
+	if (bDebugPhysicsBoneWeights && DebugBoneWeightString.Len() > 0)
 	{
-		GEngine->AddOnScreenDebugMessage(GetUniqueDrawDebugKey(792), DeltaTime * 2.f, FColor::Purple, DebugBoneWeightString);
+		GEngine->AddOnScreenDebugMessage(GetUniqueDrawDebugKey(792), DeltaTime * 2.f, FColor::Purple, FString(DebugBoneWeightString.ToView()));
 	}
 #endif
 	
@@ -833,6 +1374,10 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 		}
 	}
 
+	// Coalesce the impulses into a single input for the physics thread when physics ticks asynchronously
+	FHitReactAsyncInput* AsyncInput = AsyncPhysicsCallback ? AsyncPhysicsCallback->GetProducerInputData_External() : nullptr;
+	const FBodyInstance* ImpulseBody = AsyncInput ? Mesh->GetBodyInstance(ImpulseBoneName) : nullptr;
+
 	// Linear impulse
 	if (LinearParams.CanBeApplied())
 	{
@@ -843,7 +1388,14 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 		if (!Linear.IsNearlyZero())
 		{
 			// Apply impulse to impulse bone if set, otherwise apply to simulated bone
-			Mesh->AddImpulse(Linear, ImpulseBoneName, LinearParams.IsVelocityChange());
+			if (AsyncInput)
+			{
+				AsyncInput->AddImpulse(ImpulseBody, Linear, LinearParams.IsVelocityChange());
+			}
+			else
+			{
+				Mesh->AddImpulse(Linear, ImpulseBoneName, LinearParams.IsVelocityChange());
+			}
 			
 #if UE_ENABLE_DEBUG_DRAWING
 			if (FHitReactCVars::DrawHitReact > 0)
@@ -866,14 +1418,23 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 		if (!Angular.IsNearlyZero())
 		{
 			// Apply impulse to impulse bone if set, otherwise apply to simulated bone
-			switch (AngularParams.AngularUnits)
+			if (AsyncInput)
 			{
-			case EHitReactUnits::Degrees:
-				Mesh->AddAngularImpulseInDegrees(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
-				break;
-			case EHitReactUnits::Radians:
-				Mesh->AddAngularImpulseInRadians(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
-				break;
+				const FVector AngularRadians = AngularParams.AngularUnits == EHitReactUnits::Degrees ?
+					FMath::DegreesToRadians(Angular) : Angular;
+				AsyncInput->AddAngularImpulseInRadians(ImpulseBody, AngularRadians, AngularParams.IsVelocityChange());
+			}
+			else
+			{
+				switch (AngularParams.AngularUnits)
+				{
+				case EHitReactUnits::Degrees:
+					Mesh->AddAngularImpulseInDegrees(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
+					break;
+				case EHitReactUnits::Radians:
+					Mesh->AddAngularImpulseInRadians(Angular, ImpulseBoneName, AngularParams.IsVelocityChange());
+					break;
+				}
 			}
 
 #if UE_ENABLE_DEBUG_DRAWING
@@ -899,8 +1460,16 @@ void UHitReact::ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitRe
 			const ERadialImpulseFalloff Falloff = RadialParams.Falloff == EHitReactFalloff::Linear ? RIF_Linear : RIF_Constant;
 				
 			// Convert falloff
-			Mesh->AddRadialImpulse(World.RadialLocation, RadialParams.Radius, RadialParams.Impulse,
-			                       Falloff, RadialParams.IsVelocityChange());
+			if (AsyncInput)
+			{
+				AsyncInput->AddRadialImpulse(Mesh, World.RadialLocation, RadialParams.Radius, Radial,
+					Falloff, RadialParams.IsVelocityChange());
+			}
+			else
+			{
+				Mesh->AddRadialImpulse(World.RadialLocation, RadialParams.Radius, Radial,
+									   Falloff, RadialParams.IsVelocityChange());
+			}
 
 #if UE_ENABLE_DEBUG_DRAWING
 			if (FHitReactCVars::DrawHitReact > 0)
@@ -969,13 +1538,16 @@ void UHitReact::Activate(bool bReset)
 			bProfilesLoaded = false;
 			ActiveProfiles.Empty();
 			CancelAsyncLoading();
-			for (TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
+			if (ProfileLoading == EHitReactProfileLoading::Preload)  // Lazy profiles are loaded on first use
 			{
-				if (ProfilePtr.IsNull()) { continue; }
-				AsyncLoad(ProfilePtr, [this, InnerSoftProfile = MoveTemp(ProfilePtr)]() 
+				for (TSoftObjectPtr<UHitReactProfile>& ProfilePtr : AvailableProfiles)
 				{
-					ActiveProfiles.Add(InnerSoftProfile.Get());
-				});
+					if (ProfilePtr.IsNull()) { continue; }
+					AsyncLoad(ProfilePtr, [this, InnerSoftProfile = MoveTemp(ProfilePtr)]() 
+					{
+						ActiveProfiles.Add(InnerSoftProfile.Get());
+					});
+				}
 			}
 			for (TSoftObjectPtr<UHitReactBoneData>& BoneDataPtr : AvailableBoneData)
 			{
@@ -1009,6 +1581,8 @@ void UHitReact::Deactivate()
 
 	bHasInitialized = false;
 	bProfilesLoaded = false;
+	PendingHits.Reset();
+	PendingHitsHead = 0;
 	if (!IsActive())
 	{
 		ResetHitReactSystem();
@@ -1029,6 +1603,13 @@ void UHitReact::OnFinishedLoading()
 	}
 	Mesh->OnAnimInitialized.AddDynamic(this, &ThisClass::OnMeshPoseInitialized);
 
+	// Bind to the mesh's physics state changes, impulses for the async physics callback reference its bodies
+	if (Mesh->OnComponentPhysicsStateChanged.IsAlreadyBound(this, &ThisClass::OnMeshPhysicsStateChanged))
+	{
+		Mesh->OnComponentPhysicsStateChanged.RemoveDynamic(this, &ThisClass::OnMeshPhysicsStateChanged);
+	}
+	Mesh->OnComponentPhysicsStateChanged.AddDynamic(this, &ThisClass::OnMeshPhysicsStateChanged);
+
 	// Initialize the tick function
 	PrimaryComponentTick.bAllowTickOnDedicatedServer = bApplyHitReactOnDedicatedServer;
 	PrimaryComponentTick.GetPrerequisites().Reset();
@@ -1045,6 +1626,15 @@ void UHitReact::OnFinishedLoading()
 	GlobalToggle.State.BlendParams = GlobalToggle.Params;  // Use the default parameters
 	GlobalToggle.State.Initialize(true);
 
+	// Create the physics state now rather than on the first hit react
+	if (bWarmPhysicsState)
+	{
+		WarmPhysicsState();
+	}
+
+	// Apply any hit reacts that were requested while loading
+	ReplayPendingHits();
+
 	// Broadcast the initialization event
 	for (const TSharedRef<FOnHitReactInitialized>& Delegate : RegisteredInitDelegates)
 	{
@@ -1052,78 +1642,968 @@ void UHitReact::OnFinishedLoading()
 	}
 }
 
-bool UHitReact::OnHitReactInitialized(FOnHitReactInitialized Delegate)
+void UHitReact::QueuePendingHit(const FHitReactInputParams& Params, const FHitReactImpulseParams& Impulse,
+	const FHitReactImpulse_WorldParams& World, float ImpulseScalar, float HitTime)
 {
-	if (ensure(Delegate.IsBound()))
-	{
-		if (bHasInitialized)
-		{
-			Delegate.Execute();
-		}
-		else
-		{
-			const TSharedRef<FOnHitReactInitialized> SharedDelegate = MakeShared<FOnHitReactInitialized>(MoveTemp(Delegate));
-			RegisteredInitDelegates.Add(SharedDelegate);
-		}
-
-		return true;
-	}
+	// Discard the oldest hit react if we're at capacity
+	HitReactQueue::Push(PendingHits, PendingHitsHead,
+		FHitReactQueuedHit(FHitReactTrigger(Params, Impulse), World, ImpulseScalar, HitTime), MaxPendingHits);
+}
 
-	return false;
+void UHitReact::TakePendingHits(TArray<FHitReactQueuedHit>& OutHits)
+{
+	HitReactQueue::Take(PendingHits, PendingHitsHead, OutHits);
 }
 
-void UHitReact::ToggleHitReactSystem(bool bEnabled, bool bInterpolateState, bool bUseDefaultBlendParams,
-	FHitReactPhysicsStateParamsSimple BlendParams)
+void UHitReact::ReplayPendingHits()
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ToggleHitReactSystem);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ReplayPendingHits);
 
-	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
-	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	if (PendingHits.Num() == 0)
 	{
 		return;
 	}
 
-	// Set the global alpha interpolation parameters if we're interpolating
-	if (bInterpolateState)
-	{
-		const FHitReactPhysicsStateParamsSimple& Params = bUseDefaultBlendParams ? GlobalToggle.Params : BlendParams;
-		GlobalToggle.State.BlendParams = Params;
-	}
-	
-	// Only if the state changed
-	if (GlobalToggle.State.bToggleEnabled != bEnabled)
-	{
-		GlobalToggle.State.bToggleEnabled = bEnabled;
-		WakeHitReact();
-		OnHitReactToggleStateChanged.Broadcast(GetHitReactToggleState());
-	}
+	TArray<FHitReactQueuedHit> HitsToReplay;
+	TakePendingHits(HitsToReplay);
+	HitReactBatch(HitsToReplay);
 }
 
-EHitReactToggleState UHitReact::GetHitReactToggleState() const
+void UHitReact::ReplayPendingHits(const FSoftObjectPath& ProfilePath)
 {
-	if (GlobalToggle.State.HasCompleted())
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ReplayPendingHits);
+
+	// Hit reacts waiting on other profiles remain queued
+	TArray<FHitReactQueuedHit> HitsToReplay;
+	HitReactQueue::Extract(PendingHits, PendingHitsHead, ProfilePath, HitsToReplay);
+
+	if (HitsToReplay.Num() > 0)
 	{
-		return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabled : EHitReactToggleState::Disabled;
+		HitReactBatch(HitsToReplay);
+	}
+}
+
+void UHitReact::RequestLazyProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile)
+{
+	UHitReactProfileCache* ProfileCache = UHitReactProfileCache::Get();
+	const FSoftObjectPath ProfilePath = SoftProfile.ToSoftObjectPath();
+
+	// Bind a single callback per profile, regardless of how many hit reacts are waiting on it
+	if (!ProfileCache || LoadingProfiles.Contains(ProfilePath))
+	{
+		return;
+	}
+	LoadingProfiles.Add(ProfilePath);
+
+	// Without lazy loading, queued hit reacts wait for every profile instead, and are replayed in OnFinishedLoading
+	const bool bRequested = ProfileCache->RequestProfile(SoftProfile, FSimpleDelegate::CreateWeakLambda(this, [this, ProfilePath]()
+	{
+		LoadingProfiles.Remove(ProfilePath);
+		if (ProfileLoading == EHitReactProfileLoading::Lazy)
+		{
+			ReplayPendingHits(ProfilePath);
+		}
+		SendPendingBroadcasts(ProfilePath);
+	}));
+
+	// The profile can't be loaded, nothing will replay the hit reacts or send the broadcasts waiting on it
+	if (!bRequested)
+	{
+		LoadingProfiles.Remove(ProfilePath);
+		TArray<FHitReactQueuedHit> DiscardedHits;
+		if (ProfileLoading == EHitReactProfileLoading::Lazy)
+		{
+			HitReactQueue::Extract(PendingHits, PendingHitsHead, ProfilePath, DiscardedHits);
+		}
+		HitReactQueue::Extract(PendingBroadcasts, PendingBroadcastsHead, ProfilePath, DiscardedHits);
+	}
+}
+
+void UHitReact::SortPhysicsBlends()
+{
+	// This is necessary because we need to process parent bones before we can process child bones
+	// A child bone must continue to simulate if the parent bone has any blend weight
+	PhysicsBlends.Sort([this](const FHitReactPhysics& A, const FHitReactPhysics& B)
+	{
+		const int32 AIndex = Mesh->GetBoneIndex(A.SimulatedBoneName);
+		const int32 BIndex = Mesh->GetBoneIndex(B.SimulatedBoneName);
+		return AIndex < BIndex;
+	});
+	PhysicsBlendPool.Remap(PhysicsBlends);
+	bBlendEvaluatorDirty = true;
+}
+
+int32 UHitReact::HitReactBatch(const TArray<FHitReactQueuedHit>& Hits)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::HitReactBatch);
+
+	if (Hits.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Apply in the order they were requested, so cooldowns and subsequent impulses are evaluated as they would have been
+	TArray<const FHitReactQueuedHit*, TInlineAllocator<16>> SortedHits;
+	SortedHits.Reserve(Hits.Num());
+	for (const FHitReactQueuedHit& Hit : Hits)
+	{
+		SortedHits.Add(&Hit);
+	}
+	SortedHits.StableSort([](const FHitReactQueuedHit& A, const FHitReactQueuedHit& B)
+	{
+		return A.HitTime < B.HitTime;
+	});
+
+	const int32 NumBlends = PhysicsBlends.Num();
+	int32 NumApplied = 0;
+	{
+		TGuardValue<bool> DeferSortGuard(bDeferBlendSort, true);
+		for (const FHitReactQueuedHit* Hit : SortedHits)
+		{
+			if (ApplyHitReact(Hit->Trigger, Hit->Trigger.Impulse, Hit->World, Hit->ImpulseScalar, Hit->HitTime))
+			{
+				NumApplied++;
+			}
+		}
+	}
+
+	// Nested batches leave sorting to the outermost batch
+	if (!bDeferBlendSort && PhysicsBlends.Num() != NumBlends && Mesh)
+	{
+		SortPhysicsBlends();
+	}
+
+	return NumApplied;
+}
+
+bool UHitReact::EnqueueHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+	float ImpulseScalar, float HitTime)
+{
+	// Reserve a place in the queue first, so concurrent callers can't exceed the limit
+	const int32 NumHits = NumEnqueuedHits.fetch_add(1);
+	if (NumHits >= MaxEnqueuedHits)
+	{
+		NumEnqueuedHits.fetch_sub(1);
+		return false;
+	}
+
+	EnqueuedHits.Enqueue(Params, World, ImpulseScalar, HitTime);
+
+	// Wake the component unless a wake is already on its way, whatever the count, as it may have discarded the queue
+	// and gone to sleep while another thread was still queueing
+	if (!bEnqueuedWakePending.exchange(true))
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakThis = TWeakObjectPtr<UHitReact>(this)]()
+		{
+			if (UHitReact* HitReact = WeakThis.Get())
+			{
+				HitReact->bEnqueuedWakePending = false;
+				HitReact->WakeHitReact();
+			}
+		});
+	}
+	return true;
+}
+
+int32 UHitReact::ApplyEnqueuedHits()
+{
+	check(IsInGameThread());
+
+	if (NumEnqueuedHits.load() == 0)
+	{
+		return 0;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplyEnqueuedHits);
+
+	// Hit reacts without a time occurred now, and are applied after any that were stamped earlier
+	const float WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+
+	TArray<FHitReactQueuedHit> Hits;
+	while (TOptional<FHitReactQueuedHit> Hit = EnqueuedHits.Dequeue())
+	{
+		if (Hit->HitTime < 0.f)
+		{
+			Hit->HitTime = WorldTime;
+		}
+		Hits.Add(MoveTemp(Hit.GetValue()));
+	}
+	NumEnqueuedHits.fetch_sub(Hits.Num());
+
+	return HitReactBatch(Hits);
+}
+
+void UHitReact::DiscardEnqueuedHits()
+{
+	int32 NumHits = 0;
+	while (EnqueuedHits.Dequeue().IsSet())
+	{
+		NumHits++;
+	}
+	NumEnqueuedHits.fetch_sub(NumHits);
+}
+
+bool UHitReact::BroadcastHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+	float ImpulseScalar)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::BroadcastHitReact);
+
+	if (!bReplicateHits || !IsValid(GetOwner()) || !GetOwner()->HasAuthority() || !GetWorld())
+	{
+		return false;
+	}
+
+	// Send the hit react to clients in its compact representation, stamped with the server time it occurred at
+	const float ServerTime = GetWorld()->GetTimeSeconds();
+	FHitReactQueuedHit Hit = { MakeCompactTrigger(Params), MakeCompactWorldParams(World, Params.Impulse),
+		ImpulseScalar, ServerTime };
+
+	// The profile decides who receives the hit react, wait for it to load rather than sending it to everyone
+	bool bProfilePending = false;
+	const UHitReactProfile* Profile = FindBroadcastProfile(Params.Profile, bProfilePending);
+	if (bProfilePending)
+	{
+		// Queue before requesting the load, which may complete immediately and send it
+		HitReactQueue::Push(PendingBroadcasts, PendingBroadcastsHead, MoveTemp(Hit), MaxPendingHits);
+		RequestLazyProfile(Params.Profile);
+	}
+	else
+	{
+		SendHitReact(Hit, Profile);
+	}
+
+	// Apply locally, e.g. for listen servers
+	HitReactTrigger(Params, World, ImpulseScalar);
+	return true;
+}
+
+void UHitReact::SendHitReact(const FHitReactQueuedHit& Hit, const UHitReactProfile* Profile)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::SendHitReact);
+
+	if (!GetWorld())
+	{
+		return;
+	}
+
+	// Profiles that cull by distance are only sent to the players that are relevant and close enough to see them
+	bool bRelayed = false;
+	if (Profile && Profile->CullDistance > 0.f)
+	{
+		TArray<APlayerController*> Recipients;
+		GatherHitReactRecipients(Profile->CullDistance, Recipients);
+
+		// Local players apply it directly, see BroadcastHitReact
+		TArray<UHitReactClientRelay*, TInlineAllocator<8>> Relays;
+		bRelayed = true;
+		for (APlayerController* PlayerController : Recipients)
+		{
+			if (PlayerController->IsLocalController())
+			{
+				continue;
+			}
+
+			// Players without a relay on their client yet would never receive it, replicate to everyone instead
+			UHitReactClientRelay* Relay = UHitReactClientRelay::FindOrAdd(PlayerController);
+			bRelayed &= Relay && Relay->IsClientReady();
+			Relays.Add(Relay);
+		}
+
+		if (bRelayed)
+		{
+			for (UHitReactClientRelay* Relay : Relays)
+			{
+				Relay->AddHit(this, Hit);
+			}
+		}
+	}
+
+	if (!bRelayed)
+	{
+		NetHits.AddHit(Hit, MaxReplicatedHits, GetWorld()->GetTimeSeconds() - MaxReplicatedHitAge);
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, NetHits, this);
+	}
+}
+
+void UHitReact::SendPendingBroadcasts(const FSoftObjectPath& ProfilePath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::SendPendingBroadcasts);
+
+	// Broadcasts waiting on other profiles remain queued
+	TArray<FHitReactQueuedHit> HitsToSend;
+	HitReactQueue::Extract(PendingBroadcasts, PendingBroadcastsHead, ProfilePath, HitsToSend);
+
+	for (const FHitReactQueuedHit& Hit : HitsToSend)
+	{
+		bool bProfilePending = false;
+		SendHitReact(Hit, FindBroadcastProfile(Hit.Trigger.Profile, bProfilePending));
+	}
+}
+
+const UHitReactProfile* UHitReact::FindBroadcastProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile,
+	bool& bOutPending) const
+{
+	bOutPending = false;
+
+	if (const UHitReactProfile* LoadedProfile = SoftProfile.Get())
+	{
+		return LoadedProfile;
+	}
+
+	// Servers don't necessarily load profiles themselves, e.g. dedicated servers never activate the system
+	UHitReactProfileCache* ProfileCache = UHitReactProfileCache::Get();
+	if (!ProfileCache || SoftProfile.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const UHitReactProfile* ResidentProfile = ProfileCache->UseProfile(SoftProfile))
+	{
+		return ResidentProfile;
+	}
+
+	bOutPending = !ProfileCache->HasProfileFailed(SoftProfile);
+	return nullptr;
+}
+
+void UHitReact::GetHitReactRecipients(const TSoftObjectPtr<UHitReactProfile>& Profile,
+	TArray<APlayerController*>& OutPlayers) const
+{
+	bool bProfilePending = false;
+	const UHitReactProfile* LoadedProfile = FindBroadcastProfile(Profile, bProfilePending);
+	GatherHitReactRecipients(LoadedProfile ? LoadedProfile->CullDistance : 0.f, OutPlayers);
+}
+
+void UHitReact::GatherHitReactRecipients(float CullDistance, TArray<APlayerController*>& OutPlayers) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::GatherHitReactRecipients);
+
+	OutPlayers.Reset();
+
+	const AActor* Owner = GetOwner();
+	const UWorld* World = GetWorld();
+	if (!IsValid(Owner) || !World)
+	{
+		return;
+	}
+
+	const FVector OwnerLocation = Owner->GetActorLocation();
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (!IsValid(PlayerController))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (CullDistance > 0.f && FVector::DistSquared(ViewLocation, OwnerLocation) > FMath::Square(CullDistance))
+		{
+			continue;
+		}
+
+		// The connection won't have the owner if it isn't relevant to it
+		if (!PlayerController->IsLocalController() &&
+			!Owner->IsNetRelevantFor(PlayerController, PlayerController->GetViewTarget(), ViewLocation))
+		{
+			continue;
+		}
+
+		OutPlayers.Add(PlayerController);
+	}
+}
+
+bool UHitReact::IsCulledForLocalViewers(const UHitReactProfile* Profile) const
+{
+	if (!Profile || !Mesh || !GetWorld())
+	{
+		return false;
+	}
+
+	if (!Profile->bCullWhenNotRendered && Profile->CullDistance <= 0.f)
+	{
+		return false;
+	}
+
+	// Without a local viewer, e.g. dedicated servers and headless worlds, there is nobody to cull for
+	const FVector MeshLocation = Mesh->GetComponentLocation();
+	bool bHasLocalViewer = false;
+	bool bWithinCullDistance = Profile->CullDistance <= 0.f;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		bHasLocalViewer = true;
+		if (bWithinCullDistance)
+		{
+			break;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		bWithinCullDistance = FVector::DistSquared(ViewLocation, MeshLocation) <= FMath::Square(Profile->CullDistance);
+	}
+
+	if (!bHasLocalViewer)
+	{
+		return false;
+	}
+
+	if (Profile->bCullWhenNotRendered && !Mesh->WasRecentlyRendered(Profile->RecentlyRenderedTime))
+	{
+		return true;
+	}
+
+	return !bWithinCullDistance;
+}
+
+void UHitReact::GetSpringImpulses(uint32& InOutSerial, TArray<FHitReactPendingImpulse>& OutImpulses) const
+{
+	// Impulses that were discarded before the caller read them are skipped
+	const uint32 OldestSerial = NumSpringImpulses - SpringImpulses.Num();
+	for (uint32 Serial = FMath::Max(InOutSerial, OldestSerial); Serial < NumSpringImpulses; Serial++)
+	{
+		OutImpulses.Add(SpringImpulses[Serial % HitReactMaxSpringImpulses]);
+	}
+	InOutSerial = NumSpringImpulses;
+}
+
+void UHitReact::ReceiveReplicatedHits(TArray<FHitReactQueuedHit>& Hits)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ReceiveReplicatedHits);
+
+	const UWorld* World = GetWorld();
+	if (!World || !IsValid(GetOwner()) || GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	// Convert from server time to local time
+	const AGameStateBase* GameState = World->GetGameState();
+	const float LocalTime = World->GetTimeSeconds();
+	const float ServerTime = GameState ? static_cast<float>(GameState->GetServerWorldTimeSeconds()) : LocalTime;
+
+	Hits.RemoveAll([this, ServerTime](const FHitReactQueuedHit& Hit)
+	{
+		return ServerTime - Hit.HitTime > MaxReplicatedHitAge;
+	});
+
+	for (FHitReactQueuedHit& Hit : Hits)
+	{
+		Hit.HitTime = LocalTime - FMath::Max(0.f, ServerTime - Hit.HitTime);
+	}
+
+	HitReactBatch(Hits);
+}
+
+const UHitReactProfile* UHitReact::FindProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile, bool& bOutPending)
+{
+	bOutPending = false;
+
+	if (ProfileLoading == EHitReactProfileLoading::Lazy)
+	{
+		UHitReactProfileCache* ProfileCache = UHitReactProfileCache::Get();
+		if (!ProfileCache)
+		{
+			return nullptr;
+		}
+
+		// Resident profiles are shared between all components
+		if (const UHitReactProfile* Profile = ProfileCache->UseProfile(SoftProfile))
+		{
+			return Profile;
+		}
+
+		// Load on first use, the caller queues the hit react then calls RequestLazyProfile()
+		bOutPending = !SoftProfile.IsNull() && !ProfileCache->HasProfileFailed(SoftProfile);
+		return nullptr;
+	}
+
+	if (!SoftProfile.IsValid())
+	{
+		return nullptr;
+	}
+
+	const TObjectPtr<const UHitReactProfile>* ProfilePtr = ActiveProfiles.FindByPredicate([&SoftProfile](const TObjectPtr<const UHitReactProfile>& InProfile)
+	{
+		return InProfile == SoftProfile.Get();
+	});
+
+	return ProfilePtr ? *ProfilePtr : nullptr;
+}
+
+bool UHitReact::OnHitReactInitialized(FOnHitReactInitialized Delegate)
+{
+	if (ensure(Delegate.IsBound()))
+	{
+		if (bHasInitialized)
+		{
+			Delegate.Execute();
+		}
+		else
+		{
+			const TSharedRef<FOnHitReactInitialized> SharedDelegate = MakeShared<FOnHitReactInitialized>(MoveTemp(Delegate));
+			RegisteredInitDelegates.Add(SharedDelegate);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+void UHitReact::ToggleHitReactSystem(bool bEnabled, bool bInterpolateState, bool bUseDefaultBlendParams,
+	FHitReactPhysicsStateParamsSimple BlendParams)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ToggleHitReactSystem);
+
+	// Dedicated servers don't need cosmetic hit reacts - unless perhaps you're doing some kind of replay system
+	if (GetNetMode() == NM_DedicatedServer && !bApplyHitReactOnDedicatedServer)
+	{
+		return;
+	}
+
+	// Set the global alpha interpolation parameters if we're interpolating
+	if (bInterpolateState)
+	{
+		const FHitReactPhysicsStateParamsSimple& Params = bUseDefaultBlendParams ? GlobalToggle.Params : BlendParams;
+		GlobalToggle.State.BlendParams = Params;
+	}
+	
+	// Only if the state changed
+	if (GlobalToggle.State.bToggleEnabled != bEnabled)
+	{
+		GlobalToggle.State.bToggleEnabled = bEnabled;
+		WakeHitReact();
+		OnHitReactToggleStateChanged.Broadcast(GetHitReactToggleState());
+	}
+}
+
+EHitReactToggleState UHitReact::GetHitReactToggleState() const
+{
+	if (GlobalToggle.State.HasCompleted())
+	{
+		return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabled : EHitReactToggleState::Disabled;
 	}
 		
 	return GlobalToggle.State.bToggleEnabled ? EHitReactToggleState::Enabling : EHitReactToggleState::Disabling;
 }
 
-bool UHitReact::ShouldSleep() const
+bool UHitReact::ShouldSleep() const
+{
+	if (!bHasInitialized || !bProfilesLoaded)
+	{
+		return true;
+	}
+	if (ProfileLoading == EHitReactProfileLoading::Preload && ActiveProfiles.Num() == 0)
+	{
+		return true;
+	}
+	if (IsHitReactSystemToggleInProgress())
+	{
+		return false;
+	}
+	if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
+	{
+		return true;
+	}
+	return false;
+}
+
+void UHitReact::TouchBodySimState(const FBodyInstance* BI, const UHitReactProfile* Profile)
+{
+	if (!BodySimStates.IsValidIndex(BI->InstanceBodyIndex))
+	{
+		return;
+	}
+
+	FHitReactBodySimState& SimState = BodySimStates[BI->InstanceBodyIndex];
+	if (SimState.LastTouchedSerial != SimStateSerial)
+	{
+		// First blend to touch this body this tick
+		SimState.LastTouchedSerial = SimStateSerial;
+		SimState.EnableThreshold = Profile->SimulateEnableThreshold;
+		SimState.DisableThreshold = Profile->SimulateDisableThreshold;
+		SimState.MinSimulateTime = Profile->MinSimulateTime;
+		SimState.BlendRate = Profile->BoneBlendRate;
+		SimState.bTracked = true;
+	}
+	else
+	{
+		// Favor the most responsive thresholds and the longest simulate time
+		SimState.EnableThreshold = FMath::Min(SimState.EnableThreshold, Profile->SimulateEnableThreshold);
+		SimState.DisableThreshold = FMath::Min(SimState.DisableThreshold, Profile->SimulateDisableThreshold);
+		SimState.MinSimulateTime = FMath::Max(SimState.MinSimulateTime, Profile->MinSimulateTime);
+		SimState.BlendRate = FMath::Max(SimState.BlendRate, Profile->BoneBlendRate);
+	}
+}
+
+int32 UHitReact::ApplySimulateFlips()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplySimulateFlips);
+
+	const float TimeSeconds = GetWorld()->GetTimeSeconds();
+
+	const bool bHadWeightedBodies = NumWeightedBodies > 0;
+
+	int32 NumFlips = 0;
+	NumWeightedBodies = 0;
+	bHasSimulatingBodies = false;
+	for (int32 BodyIndex = 0; BodyIndex < BodySimStates.Num(); BodyIndex++)
+	{
+		FHitReactBodySimState& SimState = BodySimStates[BodyIndex];
+		FBodyInstance* BI = SimState.bTracked && Mesh->Bodies.IsValidIndex(BodyIndex) ? Mesh->Bodies[BodyIndex] : nullptr;
+		if (!BI)
+		{
+			continue;
+		}
+
+		// Bodies no longer touched by any physics blend are blending out
+		const bool bTouched = SimState.LastTouchedSerial == SimStateSerial;
+		const float BlendWeight = bTouched ? BI->PhysicsBlendWeight : 0.f;
+
+		if (!BI->bSimulatePhysics)
+		{
+			if (BlendWeight > SimState.EnableThreshold)
+			{
+				BI->SetInstanceSimulatePhysics(true, false, true);
+				SimState.SimulateStartTime = TimeSeconds;
+				NumFlips++;
+			}
+			else if (!bTouched)
+			{
+				// No longer managed by the hit react system
+				BI->PhysicsBlendWeight = 0.f;
+				SimState.bTracked = false;
+			}
+		}
+		else if (BlendWeight <= SimState.DisableThreshold && TimeSeconds - SimState.SimulateStartTime >= SimState.MinSimulateTime)
+		{
+			BI->PhysicsBlendWeight = 0.f;
+			BI->SetInstanceSimulatePhysics(false, false, true);
+			SimState.bTracked = false;
+			NumFlips++;
+		}
+
+		bHasSimulatingBodies |= BI->bSimulatePhysics;
+		NumWeightedBodies += SimState.bTracked && BI->PhysicsBlendWeight > 0.f ? 1 : 0;
+	}
+
+	SimStateSerial++;
+
+	if (NumFlips > 0 || bHadWeightedBodies != (NumWeightedBodies > 0))
+	{
+		bMeshPhysicsDirty = true;
+	}
+
+	NumSimulateFlips += NumFlips;
+	INC_DWORD_STAT_BY(STAT_HitReactSimulateFlips, NumFlips);
+	return NumFlips;
+}
+
+bool UHitReact::EvictPhysicsBlend(EHitReactMaxBlendHandling MaxBlendHandling)
+{
+	FHitReactPhysicsHandle Handle;
+	switch (MaxBlendHandling)
+	{
+	case EHitReactMaxBlendHandling::ReplaceOldest:
+		Handle = PhysicsBlendPool.GetOldest();
+		break;
+	case EHitReactMaxBlendHandling::ReplaceLowestWeight:
+		Handle = BlendEvaluator.GetLowestWeightCandidates().Pop(PhysicsBlendPool);
+		break;
+	case EHitReactMaxBlendHandling::ReplaceFurthestBlendOut:
+		Handle = BlendEvaluator.GetFurthestBlendOutCandidates().Pop(PhysicsBlendPool);
+		break;
+	default:
+		return false;
+	}
+
+	// Every candidate from when the physics blends were last evaluated was already removed or evicted
+	// Physics blends added since then have no weight yet, fall back to the oldest instead of evicting a fresh hit react
+	int32 BlendIndex = PhysicsBlendPool.Find(Handle);
+	if (BlendIndex == INDEX_NONE)
+	{
+		Handle = PhysicsBlendPool.GetOldest();
+		BlendIndex = PhysicsBlendPool.Find(Handle);
+	}
+	if (!PhysicsBlends.IsValidIndex(BlendIndex))
+	{
+		return false;
+	}
+
+	// Console command: Log LogHitReact VeryVerbose
+	UE_LOG(LogHitReact, VeryVerbose, TEXT("Evicting physics blend on bone %s"), *PhysicsBlends[BlendIndex].SimulatedBoneName.ToString());
+
+	PhysicsBlendPool.Release(Handle);
+	BoneBlendRateSum -= PhysicsBlends[BlendIndex].Profile->BoneBlendRate;
+
+	// Swap the last physics blend into its place, the order is restored when the physics blend that replaces it is
+	// sorted in, and its bodies blend out during the next tick once no physics blend touches them
+	const int32 LastIndex = PhysicsBlends.Num() - 1;
+	if (BlendIndex != LastIndex)
+	{
+		Swap(PhysicsBlends[BlendIndex], PhysicsBlends[LastIndex]);
+		PhysicsBlendPool.Relocate(PhysicsBlends[BlendIndex].Handle, BlendIndex);
+	}
+	PhysicsBlends.Pop();
+	bBlendEvaluatorDirty = true;
+	return true;
+}
+
+bool UHitReact::MergePhysicsBlend(const FName& BoneName, const UHitReactProfile* Profile)
 {
-	if (!bHasInitialized || !bProfilesLoaded || ActiveProfiles.Num() == 0)
+	if (Profile->BlendMerge == EHitReactBlendMerge::Disabled)
 	{
-		return true;
+		return false;
 	}
-	if (IsHitReactSystemToggleInProgress())
+
+	FHitReactPhysics* Physics = PhysicsBlends.FindByPredicate([&BoneName, Profile](const FHitReactPhysics& InPhysics)
+	{
+		return InPhysics.IsActive() && InPhysics.SimulatedBoneName == BoneName && InPhysics.Profile == Profile;
+	});
+
+	if (!Physics)
 	{
 		return false;
 	}
-	if (PhysicsBlends.Num() == 0)
+
+	switch (Profile->BlendMerge)
 	{
-		return true;
+	case EHitReactBlendMerge::Restart:
+		Physics->PhysicsState.Restart();
+		break;
+	case EHitReactBlendMerge::ExtendHold:
+		Physics->PhysicsState.ExtendHold();
+		break;
+	case EHitReactBlendMerge::Rewind:
+		Physics->PhysicsState.Decay();
+		break;
+	default: break;
+	}
+
+	// Elapsed time changed, and decaying physics blends are evaluated separately
+	bBlendEvaluatorDirty = true;
+	return true;
+}
+
+TSharedPtr<const FHitReactBoneOverrides> UHitReact::GetBoneOverrides(const UHitReactProfile* Profile, const UHitReactBoneData* BoneData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::GetBoneOverrides);
+
+	// Bodies may have changed, e.g. the physics asset was swapped, since the tick last checked
+	const int32 NumBodies = Mesh->Bodies.Num();
+	ResetIfBodyAssetsChanged();
+	if (BoneOverridesCache.Num() > 0)
+	{
+		const TSharedPtr<const FHitReactBoneOverrides>& Any = BoneOverridesCache.CreateConstIterator().Value();
+		if (!Any.IsValid() || Any->DisabledBodies.Num() != NumBodies)
+		{
+			BoneOverridesCache.Reset();
+		}
+	}
+
+	TSharedPtr<const FHitReactBoneOverrides>& Cached = BoneOverridesCache.FindOrAdd(
+		{ TObjectKey<UHitReactProfile>(Profile), TObjectKey<UHitReactBoneData>(BoneData) });
+	if (Cached.IsValid())
+	{
+		return Cached;
+	}
+
+	TSharedRef<FHitReactBoneOverrides> Overrides = MakeShared<FHitReactBoneOverrides>();
+	TBitArray<>& DisabledBodies = Overrides->DisabledBodies;
+	TArray<float>& BodyWeightScalars = Overrides->BodyWeightScalars;
+	DisabledBodies.Init(false, NumBodies);
+	BodyWeightScalars.Init(1.f, NumBodies);
+
+	// Gather disabled bones and their descendents
+	TMap<FName, FHitReactBoneOverride> BoneOverrides = Profile ? Profile->BoneOverrides : TMap<FName, FHitReactBoneOverride>();
+	if (BoneData)
+	{
+		// Append BoneOverrides with optional BoneData overrides
+		for (const auto& Pair : BoneData->BoneOverrides)
+		{
+			// If an override exists already, take the higher BlendWeightScalar, and if either disables physics, disable physics
+			const FName& BoneName = Pair.Key;
+			const FHitReactBoneOverride& Override = Pair.Value;
+			FHitReactBoneOverride& ExistingOverride = BoneOverrides.FindOrAdd(BoneName);
+			if (Override.bDisablePhysics)
+			{
+				ExistingOverride.bDisablePhysics = true;
+			}
+			ExistingOverride.BlendWeightScalar = FMath::Max(ExistingOverride.BlendWeightScalar, Override.BlendWeightScalar);
+		}
+	}
+	for (const auto& Pair : BoneOverrides)
+	{
+		const FName& BoneName = Pair.Key;
+		const FHitReactBoneOverride& Override = Pair.Value;
+		if (Override.bDisablePhysics || Override.BlendWeightScalar < 1.f)
+		{
+			// Iterate all descendents
+			UHitReactStatics::ForEach(Mesh, BoneName, Override.bIncludeSelf,
+				[&Override, &DisabledBodies, &BodyWeightScalars](const FBodyInstance* BI)
+			{
+				const int32 BodyIndex = BI->InstanceBodyIndex;
+				if (!DisabledBodies.IsValidIndex(BodyIndex))
+				{
+					return true;
+				}
+
+				// Disable all descendents
+				if (Override.bDisablePhysics)
+				{
+					DisabledBodies[BodyIndex] = true;
+				}
+
+				// Limit the blend weight for all descendents
+				if (Override.BlendWeightScalar < 1.f)
+				{
+					BodyWeightScalars[BodyIndex] = Override.BlendWeightScalar;
+				}
+
+				// Continue to the next bone
+				return true;
+			});
+		}
+	}
+
+	// Exclude the blacklisted bodies too, neither are ever chosen to simulate
+	TBitArray<>& ExcludedBodies = Overrides->ExcludedBodies;
+	ExcludedBodies = DisabledBodies;
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex++)
+	{
+		const FBodyInstance* BI = Mesh->Bodies[BodyIndex];
+		if (!BI || BlacklistedBones.Contains(UHitReactStatics::GetBoneName(Mesh, BI)))
+		{
+			ExcludedBodies[BodyIndex] = true;
+		}
+	}
+
+	// Resolve the body each bone simulates, this is the first body at or below the bone in physics asset order
+	// that isn't excluded, matching UHitReactStatics::ForEach. Visiting the bodies in order, each is the answer for
+	// itself and every ancestor that doesn't have one yet
+	const FReferenceSkeleton* RefSkeleton = Mesh->GetSkeletalMeshAsset() ? &Mesh->GetSkeletalMeshAsset()->GetRefSkeleton() : nullptr;
+	const int32 NumBones = RefSkeleton ? RefSkeleton->GetNum() : 0;
+	Overrides->SimulatedBodies.Init(INDEX_NONE, NumBones);
+	Overrides->SimulatedChildBodies.Init(INDEX_NONE, NumBones);
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex++)
+	{
+		if (ExcludedBodies[BodyIndex])
+		{
+			continue;
+		}
+
+		if (Overrides->FirstSimulatedBody == INDEX_NONE)
+		{
+			Overrides->FirstSimulatedBody = BodyIndex;
+		}
+
+		const int32 BoneIndex = Mesh->Bodies[BodyIndex]->InstanceBoneIndex;
+		if (!Overrides->SimulatedBodies.IsValidIndex(BoneIndex))
+		{
+			continue;
+		}
+
+		if (Overrides->SimulatedBodies[BoneIndex] == INDEX_NONE)
+		{
+			Overrides->SimulatedBodies[BoneIndex] = BodyIndex;
+		}
+		for (int32 ParentIndex = RefSkeleton->GetParentIndex(BoneIndex); ParentIndex != INDEX_NONE;
+			ParentIndex = RefSkeleton->GetParentIndex(ParentIndex))
+		{
+			if (Overrides->SimulatedBodies[ParentIndex] == INDEX_NONE)
+			{
+				Overrides->SimulatedBodies[ParentIndex] = BodyIndex;
+			}
+			if (Overrides->SimulatedChildBodies[ParentIndex] == INDEX_NONE)
+			{
+				Overrides->SimulatedChildBodies[ParentIndex] = BodyIndex;
+			}
+		}
+	}
+
+	Cached = Overrides;
+	return Cached;
+}
+
+void UHitReact::ApplyConstraintProfileBelow(FName BoneName, FName ProfileName)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ApplyConstraintProfileBelow);
+
+	const UPhysicsAsset* PhysicsAsset = Mesh->GetPhysicsAsset();
+	if (!PhysicsAsset)
+	{
+		return;
+	}
+
+	// Map each body to the constraint joining it to its parent, constraints and bodies are recreated together
+	if (AppliedConstraintProfiles.Num() != Mesh->Constraints.Num() || BodyConstraintIndices.Num() != Mesh->Bodies.Num())
+	{
+		AppliedConstraintProfiles.Init(NAME_None, Mesh->Constraints.Num());
+		BodyConstraintIndices.Init(INDEX_NONE, Mesh->Bodies.Num());
+		for (int32 ConstraintIndex = 0; ConstraintIndex < Mesh->Constraints.Num(); ConstraintIndex++)
+		{
+			const FConstraintInstance* CI = Mesh->Constraints[ConstraintIndex];
+			const int32 BodyIndex = CI ? PhysicsAsset->FindBodyIndex(CI->ConstraintBone1) : INDEX_NONE;
+			if (BodyConstraintIndices.IsValidIndex(BodyIndex))
+			{
+				BodyConstraintIndices[BodyIndex] = ConstraintIndex;
+			}
+		}
+	}
+
+	UHitReactStatics::ForEach(Mesh, BoneName, true, [this, PhysicsAsset, &ProfileName](const FBodyInstance* BI)
+	{
+		const int32 ConstraintIndex = BodyConstraintIndices.IsValidIndex(BI->InstanceBodyIndex) ?
+			BodyConstraintIndices[BI->InstanceBodyIndex] : INDEX_NONE;
+
+		// Already using this profile
+		if (ConstraintIndex == INDEX_NONE || AppliedConstraintProfiles[ConstraintIndex] == ProfileName)
+		{
+			return true;  // Continue to the next bone
+		}
+
+		if (PhysicsAsset->ConstraintSetup.IsValidIndex(ConstraintIndex) && PhysicsAsset->ConstraintSetup[ConstraintIndex])
+		{
+			PhysicsAsset->ConstraintSetup[ConstraintIndex]->ApplyConstraintProfile(ProfileName, *Mesh->Constraints[ConstraintIndex], false);
+			AppliedConstraintProfiles[ConstraintIndex] = ProfileName;
+			bConstraintProfileChanged = true;
+		}
+		return true;  // Continue to the next bone
+	});
+}
+
+void UHitReact::ResetConstraintProfiles()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResetConstraintProfiles);
+
+	const UPhysicsAsset* PhysicsAsset = Mesh->GetPhysicsAsset();
+	if (!PhysicsAsset || AppliedConstraintProfiles.Num() != Mesh->Constraints.Num())
+	{
+		// Constraints were recreated since the profiles were applied, so they are already using the default profile
+		AppliedConstraintProfiles.Reset();
+		return;
+	}
+
+	for (int32 ConstraintIndex = 0; ConstraintIndex < AppliedConstraintProfiles.Num(); ConstraintIndex++)
+	{
+		FName& AppliedProfile = AppliedConstraintProfiles[ConstraintIndex];
+		if (!AppliedProfile.IsNone() && PhysicsAsset->ConstraintSetup.IsValidIndex(ConstraintIndex) && PhysicsAsset->ConstraintSetup[ConstraintIndex])
+		{
+			PhysicsAsset->ConstraintSetup[ConstraintIndex]->ApplyConstraintProfile(NAME_None, *Mesh->Constraints[ConstraintIndex], false);
+		}
+		AppliedProfile = NAME_None;
 	}
-	return false;
 }
 
 bool UHitReact::IsSleeping() const
@@ -1149,6 +2629,101 @@ bool UHitReact::NeedsCollisionEnabled() const
 	return Mesh->GetCollisionEnabled() != ECollisionEnabled::QueryAndPhysics && Mesh->GetCollisionEnabled() != ECollisionEnabled::PhysicsOnly;
 }
 
+void UHitReact::WarmPhysicsState()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::WarmPhysicsState);
+
+	if (!IsValid(Mesh) || !Mesh->GetPhysicsAsset())
+	{
+		return;
+	}
+
+	bPhysicsStateWarm = true;
+
+	// Meshes with any collision already have a physics state, only enabling physics on them is deferred to the first hit
+	if (Mesh->GetCollisionEnabled() != ECollisionEnabled::NoCollision)
+	{
+		return;
+	}
+
+	EnablePhysicsCollision();
+
+	// Don't interfere with anything until a hit react begins
+	if (PhysicsBlends.Num() == 0 && !bHasSimulatingBodies)
+	{
+		SuppressCollisionResponses();
+	}
+}
+
+void UHitReact::EnablePhysicsCollision()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::EnablePhysicsCollision);
+
+	bCollisionEnabledChanged = true;
+	DefaultCollisionEnabled = Mesh->GetCollisionEnabled();
+	const bool bHadPhysicsState = Mesh->IsPhysicsStateCreated();
+	switch (DefaultCollisionEnabled)
+	{
+	case ECollisionEnabled::NoCollision:
+	case ECollisionEnabled::ProbeOnly:
+		Mesh->SetCollisionEnabled(ECollisionEnabled::PhysicsOnly);
+		break;
+	case ECollisionEnabled::QueryOnly:
+	case ECollisionEnabled::QueryAndProbe:
+		Mesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		break;
+	default: break;
+	}
+
+	// Only meshes without any collision had no physics state, the rest only update their filters
+	if (!bHadPhysicsState && Mesh->IsPhysicsStateCreated())
+	{
+		INC_DWORD_STAT(STAT_HitReactPhysicsStateCreations);
+	}
+}
+
+void UHitReact::RestoreCollisionEnabled()
+{
+	if (!bCollisionEnabledChanged)
+	{
+		return;
+	}
+
+	// Keep the physics state of meshes without collision, restoring any other state doesn't destroy it, and would
+	// otherwise leave kinematic bodies pushing simulated objects around
+	if (bPhysicsStateWarm && DefaultCollisionEnabled == ECollisionEnabled::NoCollision)
+	{
+		SuppressCollisionResponses();
+		return;
+	}
+
+	Mesh->SetCollisionEnabled(DefaultCollisionEnabled);
+	bCollisionEnabledChanged = false;
+	bMeshPhysicsDirty = true;
+}
+
+void UHitReact::SuppressCollisionResponses()
+{
+	// Only when the mesh had no collision, otherwise we'd break queries against it
+	if (bCollisionResponsesSuppressed || !bCollisionEnabledChanged || DefaultCollisionEnabled != ECollisionEnabled::NoCollision)
+	{
+		return;
+	}
+
+	WarmCollisionResponses = Mesh->GetCollisionResponseToChannels();
+	Mesh->SetCollisionResponseToAllChannels(ECR_Ignore);
+	bCollisionResponsesSuppressed = true;
+}
+
+void UHitReact::RestoreCollisionResponses()
+{
+	if (bCollisionResponsesSuppressed)
+	{
+		Mesh->SetCollisionResponseToChannels(WarmCollisionResponses);
+		bCollisionResponsesSuppressed = false;
+	}
+}
+
 USkeletalMeshComponent* UHitReact::GetMeshFromOwner_Implementation() const
 {
 	// Default implementation, override in subclass or blueprint
@@ -1168,13 +2743,53 @@ void UHitReact::OnMeshPoseInitialized()
 	ResetHitReactSystem();
 }
 
+bool UHitReact::ResetIfBodyAssetsChanged()
+{
+	const TObjectKey<UPhysicsAsset> PhysicsAsset(Mesh->GetPhysicsAsset());
+	const TObjectKey<USkeletalMesh> SkeletalMesh(Mesh->GetSkeletalMeshAsset());
+	if (PhysicsAsset == BodiesPhysicsAsset && SkeletalMesh == BodiesSkeletalMesh)
+	{
+		return false;
+	}
+
+	BodiesPhysicsAsset = PhysicsAsset;
+	BodiesSkeletalMesh = SkeletalMesh;
+
+	// Clear the caches even when nothing is simulating, ResetHitReactSystem only does so while active
+	ResetHitReactSystem();
+	BoneOverridesCache.Reset();
+	BodySimStates.Reset();
+	return true;
+}
+
+void UHitReact::OnMeshPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange)
+{
+	// The input for this frame is pushed along with the removal of the bodies, and holds raw pointers to their proxies
+	// which the physics thread frees once removed, so they must never reach it
+	if (AsyncPhysicsCallback && StateChange == EComponentPhysicsStateChange::Destroyed)
+	{
+		if (FHitReactAsyncInput* AsyncInput = AsyncPhysicsCallback->GetProducerInputData_External())
+		{
+			AsyncInput->Reset();
+		}
+	}
+}
+
 void UHitReact::ResetHitReactSystem()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReact::ResetHitReactSystem);
 
-	if (PhysicsBlends.Num() > 0)
+	if (PhysicsBlends.Num() > 0 || bHasSimulatingBodies)
 	{
 		PhysicsBlends.Reset();
+		PhysicsBlendPool.ReleaseAll();
+		BoneOverridesCache.Reset();
+		BlendEvaluator.Reset();
+		BodyBlendWeights.Reset();
+		BodySimStates.Reset();
+		BoneBlendRateSum = 0.f;
+		bHasSimulatingBodies = false;
+		NumWeightedBodies = 0;
 	
 		if (Mesh)
 		{
@@ -1211,26 +2826,93 @@ bool UHitReact::IsLocallyControlledPlayer() const
 	return OwnerPawn && OwnerPawn->GetController<APlayerController>() && OwnerPawn->IsLocallyControlled();
 }
 
-void UHitReact::DebugHitReactResult(const FString& Result, bool bFailed) const
+uint8 UHitReact::GetDebugFlags() const
 {
 #if UE_ENABLE_DEBUG_DRAWING
-	if (!ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactResult))
+	if (DebugFlagsFrame != GFrameCounter)
 	{
-		return;
+		DebugFlagsFrame = GFrameCounter;
+		DebugFlags = 0;
+
+		// Skip the per-component checks entirely while every debug cvar is disabled
+		if (FHitReactCVars::DebugHitReactResult | FHitReactCVars::DebugHitReactBlendWeights |
+			FHitReactCVars::DebugHitReactBoneWeights | FHitReactCVars::DebugHitReactNum)
+		{
+			DebugFlags |= ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactResult) ? HitReactDebug::Result : 0;
+			DebugFlags |= ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactBlendWeights) ? HitReactDebug::BlendWeights : 0;
+			DebugFlags |= ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactBoneWeights) ? HitReactDebug::BoneWeights : 0;
+			DebugFlags |= ShouldCVarDrawDebug(FHitReactCVars::DebugHitReactNum) ? HitReactDebug::Count : 0;
+		}
 	}
-	
+	return DebugFlags;
+#else
+	return 0;
+#endif
+}
+
+uint8 UHitReact::GetDebugResultOutputs(bool bFailed) const
+{
+	uint8 Outputs = 0;
+
+#if UE_ENABLE_DEBUG_DRAWING
+	if (GetDebugFlags() & HitReactDebug::Result)
+	{
+		Outputs |= HitReactDebugResult::Screen;
+	}
+#endif
+
+#if WITH_EDITOR
+	// Rejections are rate limited across all components, so large maps don't flood the message log
+	if (bFailed && FHitReactCVars::MaxLoggedRejectionsPerSecond != 0)
+	{
+		using namespace HitReactRejectionLog;
+
+		Flush(FPlatformTime::Seconds(), false);
+
+		if (FHitReactCVars::MaxLoggedRejectionsPerSecond < 0 || NumLogged < FHitReactCVars::MaxLoggedRejectionsPerSecond)
+		{
+			NumLogged++;
+			Outputs |= HitReactDebugResult::MessageLog;
+		}
+		else
+		{
+			NumSuppressed++;
+			ScheduleFlush();
+		}
+	}
+#endif
+
+	return Outputs;
+}
+
+void UHitReact::DebugHitReactResult(const TCHAR* Result, bool bFailed) const
+{
+	if (const uint8 Outputs = GetDebugResultOutputs(bFailed))
+	{
+		OutputDebugResult(Result, bFailed, Outputs);
+	}
+}
+
+void UHitReact::OutputDebugResult(const TCHAR* Result, bool bFailed, uint8 Outputs) const
+{
+#if UE_ENABLE_DEBUG_DRAWING || WITH_EDITOR
+	const FString Message = FString::Printf(TEXT("HitReact: %s - HitReact(): %s"),
+		GetOwner() ? *GetOwner()->GetName() : TEXT("Unknown"), Result);
+#endif
+
+#if UE_ENABLE_DEBUG_DRAWING
 	// Draw the debug message
-	const FString OwnerName = GetOwner() ? GetOwner()->GetName() : TEXT("Unknown");
-	const FColor DebugColor = bFailed ? FColor::Red : FColor::Green;
-	GEngine->AddOnScreenDebugMessage(-1, 2.4f, DebugColor, FString::Printf(
-		TEXT("HitReact: %s - HitReact(): %s"), *OwnerName, *Result));
+	if (Outputs & HitReactDebugResult::Screen)
+	{
+		const FColor DebugColor = bFailed ? FColor::Red : FColor::Green;
+		GEngine->AddOnScreenDebugMessage(-1, 2.4f, DebugColor, Message);
+	}
 #endif
 
 #if WITH_EDITOR
-	if (bFailed)
+	if (Outputs & HitReactDebugResult::MessageLog)
 	{
-		const FString ErrorString = FString::Printf(TEXT("HitReact: %s - HitReact(): %s"), *OwnerName, *Result);
-		FMessageLog("PIE").Error(FText::FromString(ErrorString));
+		FMessageLog("PIE").Error(FText::FromString(Message));
 	}
 #endif
 }
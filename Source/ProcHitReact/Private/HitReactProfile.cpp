@@ -28,6 +28,13 @@ EDataValidationResult UHitReactProfile::IsDataValid(class FDataValidationContext
 		}
 	}
 
+	// Bodies would never stop simulating
+	if (SimulateDisableThreshold > SimulateEnableThreshold)
+	{
+		Context.AddError(LOCTEXT("HitReactProfile_SimulateThresholdError", "SimulateDisableThreshold cannot be greater than SimulateEnableThreshold"));
+		return EDataValidationResult::Invalid;
+	}
+
 	// Cannot have a total time of zero
 	if (BlendParams.GetTotalTime() < 0.01f)
 	{
@@ -24,17 +24,19 @@ bool UHitReactStatics::DoAnyPhysicsBodiesHaveWeight(const USkeletalMeshComponent
 	return false;
 }
 
-bool UHitReactStatics::ShouldBlendPhysicsBones(const USkeletalMeshComponent* Mesh)
+bool UHitReactStatics::ShouldBlendPhysicsBones(const USkeletalMeshComponent* Mesh, int32 NumWeightedBodies)
 {
+	// The count only includes bodies weighted by the hit react system, bodies may be weighted elsewhere, e.g. ragdoll
+	const bool bAnyBodiesHaveWeight = NumWeightedBodies > 0 || DoAnyPhysicsBodiesHaveWeight(Mesh);
 	return (Mesh->Bodies.Num() > 0) &&
 		(CollisionEnabledHasPhysics(Mesh->GetCollisionEnabled())) &&
-		(Mesh->bBlendPhysics || DoAnyPhysicsBodiesHaveWeight(Mesh));
+		(Mesh->bBlendPhysics || bAnyBodiesHaveWeight);
 }
 
-bool UHitReactStatics::ShouldRunEndPhysicsTick(const USkeletalMeshComponent* Mesh)
+bool UHitReactStatics::ShouldRunEndPhysicsTick(const USkeletalMeshComponent* Mesh, int32 NumWeightedBodies)
 {
 	return (Mesh->bEnablePhysicsOnDedicatedServer || !Mesh->IsNetMode(NM_DedicatedServer)) && // Early out if we are on a dedicated server and not running physics.
-		((Mesh->IsSimulatingPhysics() && Mesh->RigidBodyIsAwake()) || ShouldBlendPhysicsBones(Mesh));
+		((Mesh->IsSimulatingPhysics() && Mesh->RigidBodyIsAwake()) || ShouldBlendPhysicsBones(Mesh, NumWeightedBodies));
 }
 
 bool UHitReactStatics::ShouldRunClothTick(const USkeletalMeshComponent* Mesh)
@@ -52,9 +54,9 @@ bool UHitReactStatics::ShouldRunClothTick(const USkeletalMeshComponent* Mesh)
 	return false;
 }
 
-void UHitReactStatics::UpdateEndPhysicsTickRegisteredState(USkeletalMeshComponent* Mesh)
+void UHitReactStatics::UpdateEndPhysicsTickRegisteredState(USkeletalMeshComponent* Mesh, int32 NumWeightedBodies)
 {
-	Mesh->RegisterEndPhysicsTick(Mesh->PrimaryComponentTick.IsTickFunctionRegistered() && ShouldRunEndPhysicsTick(Mesh));
+	Mesh->RegisterEndPhysicsTick(Mesh->PrimaryComponentTick.IsTickFunctionRegistered() && ShouldRunEndPhysicsTick(Mesh, NumWeightedBodies));
 }
 
 void UHitReactStatics::UpdateClothTickRegisteredState(USkeletalMeshComponent* Mesh)
@@ -115,8 +117,10 @@ int32 UHitReactStatics::ForEach(USkeletalMeshComponent* Mesh, FName BoneName, bo
 	}
 }
 
-void UHitReactStatics::FinalizeMeshPhysics(USkeletalMeshComponent* Mesh)
+void UHitReactStatics::FinalizeMeshPhysics(USkeletalMeshComponent* Mesh, int32 NumWeightedBodies)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactStatics::FinalizeMeshPhysics);
+
 	if (Mesh->IsSimulatingPhysics())
 	{
 		Mesh->SetRootBodyIndex(Mesh->RootBodyData.BodyIndex);	//Update the root body data cache in case animation has moved root body relative to root joint
@@ -124,7 +128,7 @@ void UHitReactStatics::FinalizeMeshPhysics(USkeletalMeshComponent* Mesh)
 	
 	Mesh->bBlendPhysics = false;
 
-	UpdateEndPhysicsTickRegisteredState(Mesh);
+	UpdateEndPhysicsTickRegisteredState(Mesh, NumWeightedBodies);
 	UpdateClothTickRegisteredState(Mesh);
 }
 
@@ -140,17 +144,8 @@ bool UHitReactStatics::AccumulateBlendWeight(const USkeletalMeshComponent* Mesh,
 	return SetBlendWeight(Mesh, BoneName, BI->PhysicsBlendWeight + BlendWeight, ClampBlendWeight, Alpha);
 }
 
-bool UHitReactStatics::SetBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName, float BlendWeight,
-	float ClampBlendWeight, float Alpha)
+float UHitReactStatics::ApplyBlendWeight(FBodyInstance* BI, float BlendWeight, float ClampBlendWeight, float Alpha)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactStatics::SetBlendWeight);
-	
-	FBodyInstance* BI = Mesh->GetBodyInstance(BoneName);
-	if (!BI)
-	{
-		return false;
-	}
-
 	// Clamp the blend weight
 	BI->PhysicsBlendWeight = FMath::Clamp(BlendWeight, 0.f, ClampBlendWeight);
 
@@ -167,6 +162,22 @@ bool UHitReactStatics::SetBlendWeight(const USkeletalMeshComponent* Mesh, const
 		BI->PhysicsBlendWeight = 0.f;
 	}
 
+	return BI->PhysicsBlendWeight;
+}
+
+bool UHitReactStatics::SetBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName, float BlendWeight,
+	float ClampBlendWeight, float Alpha)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactStatics::SetBlendWeight);
+	
+	FBodyInstance* BI = Mesh->GetBodyInstance(BoneName);
+	if (!BI)
+	{
+		return false;
+	}
+
+	ApplyBlendWeight(BI, BlendWeight, ClampBlendWeight, Alpha);
+
 	// Set simulate physics if necessary
 	const bool bWantsSim = BI->PhysicsBlendWeight > 0.f;
 	if (bWantsSim != BI->bSimulatePhysics)
@@ -4,6 +4,9 @@
 #include "Params/HitReactImpulse.h"
 
 #include "HitReactProfile.h"
+#include "Engine/NetSerialization.h"
+#include "GameFramework/Actor.h"
+#include "System/HitReactNetQuantize.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactImpulse)
 
@@ -16,3 +19,111 @@ FHitReactPendingImpulse::FHitReactPendingImpulse(const FHitReactImpulseParams& I
 	, Profile(InProfile)
 	, ImpulseBoneName(InImpulseBoneName)
 {}
+
+void FHitReactImpulse_WorldParams::MakeNetPacked(const FHitReactImpulseParams& Impulse, const AActor* Owner)
+{
+	bNetPacked = true;
+
+	// Only send the fields that will actually be used, zero directions result in no impulse either way
+	NetFieldMask = 0;
+	if (Impulse.LinearImpulse.bApplyImpulse && !LinearDirection.IsNearlyZero())
+	{
+		NetFieldMask |= NetField_Linear;
+	}
+	if (Impulse.AngularImpulse.bApplyImpulse && !AngularDirection.IsNearlyZero())
+	{
+		NetFieldMask |= NetField_Angular;
+	}
+	if (Impulse.RadialImpulse.bApplyImpulse)
+	{
+		NetFieldMask |= NetField_Radial;
+
+		// Relative to the owner, so it quantizes well at any distance from the world origin
+		if (!bNetRadialRelative && IsValid(Owner))
+		{
+			RadialLocation -= Owner->GetActorLocation();
+			bNetRadialRelative = true;
+		}
+	}
+}
+
+void FHitReactImpulse_WorldParams::ResolveNetRelative(const AActor* Owner)
+{
+	if (bNetRadialRelative)
+	{
+		if (IsValid(Owner))
+		{
+			RadialLocation += Owner->GetActorLocation();
+		}
+		bNetRadialRelative = false;
+	}
+}
+
+bool FHitReactImpulse_WorldParams::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 bPacked = bNetPacked ? 1 : 0;
+	Ar.SerializeBits(&bPacked, 1);
+
+	if (!bPacked)
+	{
+		LinearDirection.NetSerialize(Ar, Map, bOutSuccess);
+		AngularDirection.NetSerialize(Ar, Map, bOutSuccess);
+		RadialLocation.NetSerialize(Ar, Map, bOutSuccess);
+		if (Ar.IsLoading())
+		{
+			bNetPacked = false;
+			bNetRadialRelative = false;
+			NetFieldMask = 0;
+		}
+		return !Ar.IsError();
+	}
+
+	Ar.SerializeBits(&NetFieldMask, 3);
+	if (Ar.IsLoading())
+	{
+		bNetPacked = true;
+		LinearDirection = FVector::ZeroVector;
+		AngularDirection = FVector::ZeroVector;
+		RadialLocation = FVector::ZeroVector;
+	}
+
+	if (NetFieldMask & NetField_Linear)
+	{
+		HitReactNetQuantize::SerializeDirection(Ar, LinearDirection);
+	}
+
+	if (NetFieldMask & NetField_Angular)
+	{
+		HitReactNetQuantize::SerializeDirection(Ar, AngularDirection);
+	}
+
+	if (NetFieldMask & NetField_Radial)
+	{
+		uint8 bRelative = bNetRadialRelative ? 1 : 0;
+		Ar.SerializeBits(&bRelative, 1);
+		bNetRadialRelative = bRelative != 0;
+
+		// Relative locations are small, so we can afford more precision
+		if (bNetRadialRelative)
+		{
+			bOutSuccess &= SerializePackedVector<10, 24>(RadialLocation, Ar);
+		}
+		else
+		{
+			bOutSuccess &= SerializePackedVector<1, 24>(RadialLocation, Ar);
+		}
+	}
+	else if (Ar.IsLoading())
+	{
+		bNetRadialRelative = false;
+	}
+
+	return !Ar.IsError();
+}
+
+// Impulses are copied by value through pending impulses, triggers and queued hits
+static_assert(std::is_trivially_copyable_v<FHitReactImpulse_Linear>, "Impulse structs must remain trivially copyable");
+static_assert(std::is_trivially_copyable_v<FHitReactImpulse_Angular>, "Impulse structs must remain trivially copyable");
+static_assert(std::is_trivially_copyable_v<FHitReactImpulse_Radial>, "Impulse structs must remain trivially copyable");
+static_assert(std::is_trivially_copyable_v<FHitReactImpulseParams>, "Impulse structs must remain trivially copyable");
+static_assert(std::is_trivially_copyable_v<FHitReactImpulse_WorldParams>, "Impulse structs must remain trivially copyable");
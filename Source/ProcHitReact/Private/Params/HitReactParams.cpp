@@ -0,0 +1,125 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Params/HitReactParams.h"
+
+#include "HitReactBoneData.h"
+#include "HitReactProfile.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactParams)
+
+namespace HitReactNetSerialize
+{
+	/** How an asset reference is serialized */
+	enum class EAssetMode : uint8
+	{
+		None,
+		Index,
+		Path,
+	};
+
+	/** Serialize an asset reference as an index into a per-class table when available, or as a path otherwise */
+	template<typename T>
+	static void SerializeAssetOrIndex(FArchive& Ar, int16& Index, TSoftObjectPtr<T>& Asset)
+	{
+		uint8 Mode = static_cast<uint8>(EAssetMode::None);
+		if (Ar.IsSaving())
+		{
+			Mode = static_cast<uint8>(Index != INDEX_NONE ? EAssetMode::Index :
+				Asset.IsNull() ? EAssetMode::None : EAssetMode::Path);
+		}
+		Ar.SerializeBits(&Mode, 2);
+
+		switch (static_cast<EAssetMode>(Mode))
+		{
+		case EAssetMode::Index:
+			{
+				uint32 PackedIndex = Ar.IsSaving() ? static_cast<uint32>(Index) : 0;
+				Ar.SerializeIntPacked(PackedIndex);
+				if (Ar.IsLoading())
+				{
+					Index = static_cast<int16>(FMath::Min<uint32>(PackedIndex, MAX_int16));
+					Asset.Reset();
+				}
+			}
+			break;
+		case EAssetMode::Path:
+			Ar << Asset;
+			if (Ar.IsLoading())
+			{
+				Index = INDEX_NONE;
+			}
+			break;
+		default:
+			if (Ar.IsLoading())
+			{
+				Index = INDEX_NONE;
+				Asset.Reset();
+			}
+			break;
+		}
+	}
+}
+
+void FHitReactInputParams::NetSerializeProfile(FArchive& Ar, bool bIncludeBoneData)
+{
+	HitReactNetSerialize::SerializeAssetOrIndex(Ar, NetProfileIndex, Profile);
+	if (bIncludeBoneData)
+	{
+		HitReactNetSerialize::SerializeAssetOrIndex(Ar, NetBoneDataIndex, BoneData);
+	}
+}
+
+void FHitReactInputParams::NetSerializeBones(FArchive& Ar, bool bIncludeImpulseBone)
+{
+	// Bone indices are only sent when every bone we need could be converted, otherwise fall back to names
+	uint8 bCompactBones = Ar.IsSaving() && NetSimulatedBoneIndex != INDEX_NONE && NetNumBones > 0 ? 1 : 0;
+	Ar.SerializeBits(&bCompactBones, 1);
+
+	if (!bCompactBones)
+	{
+		Ar << SimulatedBoneName;
+		if (bIncludeImpulseBone)
+		{
+			Ar << ImpulseBoneName;
+		}
+
+		if (Ar.IsLoading())
+		{
+			NetSimulatedBoneIndex = INDEX_NONE;
+			NetImpulseBoneIndex = INDEX_NONE;
+			NetNumBones = 0;
+		}
+		return;
+	}
+
+	uint32 NumBones = NetNumBones;
+	Ar.SerializeIntPacked(NumBones);
+	NumBones = FMath::Clamp<uint32>(NumBones, 1, MAX_uint16);
+
+	// Bit-packed to the number of bones in the skeleton
+	uint32 SimulatedBoneIndex = Ar.IsSaving() ? static_cast<uint32>(NetSimulatedBoneIndex) : 0;
+	Ar.SerializeInt(SimulatedBoneIndex, NumBones);
+
+	uint8 bHasImpulseBone = 0;
+	uint32 ImpulseBoneIndex = 0;
+	if (bIncludeImpulseBone)
+	{
+		bHasImpulseBone = Ar.IsSaving() && NetImpulseBoneIndex != INDEX_NONE ? 1 : 0;
+		Ar.SerializeBits(&bHasImpulseBone, 1);
+		if (bHasImpulseBone)
+		{
+			ImpulseBoneIndex = Ar.IsSaving() ? static_cast<uint32>(NetImpulseBoneIndex) : 0;
+			Ar.SerializeInt(ImpulseBoneIndex, NumBones);
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		NetNumBones = static_cast<uint16>(NumBones);
+		NetSimulatedBoneIndex = static_cast<int16>(FMath::Min<uint32>(SimulatedBoneIndex, MAX_int16));
+		NetImpulseBoneIndex = bHasImpulseBone ? static_cast<int16>(FMath::Min<uint32>(ImpulseBoneIndex, MAX_int16)) : INDEX_NONE;
+		SimulatedBoneName = NAME_None;
+		ImpulseBoneName = NAME_None;
+	}
+}
@@ -0,0 +1,221 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactAsyncPhysics.h"
+
+#include "Chaos/Utilities.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+#include "PBDRigidsSolver.h"
+
+namespace FHitReactCVars
+{
+	static bool bAsyncPhysics = true;
+	FAutoConsoleVariableRef CVarAsyncPhysics(
+		TEXT("p.HitReact.AsyncPhysics"),
+		bAsyncPhysics,
+		TEXT("If true, components with bUseAsyncPhysics apply their impulses on the physics thread when physics ticks asynchronously.\n"),
+		ECVF_Default);
+}
+
+FHitReactAsyncBodyImpulse* FHitReactAsyncInput::FindOrAddBody(const FBodyInstance* BI)
+{
+	Chaos::FSingleParticlePhysicsProxy* Proxy = BI ? BI->GetPhysicsActorHandle() : nullptr;
+	if (!Proxy)
+	{
+		return nullptr;
+	}
+
+	// Only a handful of bodies receive impulses in a frame
+	for (FHitReactAsyncBodyImpulse& Body : BodyImpulses)
+	{
+		if (Body.Proxy == Proxy)
+		{
+			return &Body;
+		}
+	}
+
+	FHitReactAsyncBodyImpulse& Body = BodyImpulses.AddDefaulted_GetRef();
+	Body.Proxy = Proxy;
+	return &Body;
+}
+
+void FHitReactAsyncInput::AddImpulse(const FBodyInstance* BI, const FVector& Impulse, bool bVelocityChange)
+{
+	if (FHitReactAsyncBodyImpulse* Body = FindOrAddBody(BI))
+	{
+		(bVelocityChange ? Body->LinearVelocity : Body->LinearImpulse) += Impulse;
+	}
+}
+
+void FHitReactAsyncInput::AddAngularImpulseInRadians(const FBodyInstance* BI, const FVector& Impulse, bool bVelocityChange)
+{
+	if (FHitReactAsyncBodyImpulse* Body = FindOrAddBody(BI))
+	{
+		(bVelocityChange ? Body->AngularVelocity : Body->AngularImpulse) += Impulse;
+	}
+}
+
+void FHitReactAsyncInput::AddRadialImpulse(const USkeletalMeshComponent* Mesh, const FVector& Origin, float Radius,
+	float Strength, ERadialImpulseFalloff Falloff, bool bVelocityChange)
+{
+	FHitReactAsyncRadialImpulse& Radial = RadialImpulses.AddDefaulted_GetRef();
+	Radial.Origin = Origin;
+	Radial.Radius = Radius;
+	Radial.Strength = Strength;
+	Radial.Falloff = Falloff;
+	Radial.bVelocityChange = bVelocityChange;
+	Radial.FirstProxy = RadialProxies.Num();
+
+	// Bodies that are kinematic by the time the physics thread runs are skipped there
+	for (const FBodyInstance* BI : Mesh->Bodies)
+	{
+		if (Chaos::FSingleParticlePhysicsProxy* Proxy = BI ? BI->GetPhysicsActorHandle() : nullptr)
+		{
+			RadialProxies.Add(Proxy);
+		}
+	}
+	Radial.NumProxies = RadialProxies.Num() - Radial.FirstProxy;
+}
+
+bool FHitReactAsyncCallback::IsAvailable(const UWorld* World)
+{
+	return FHitReactCVars::bAsyncPhysics && World && World->GetPhysicsScene() && UPhysicsSettings::Get()->bTickPhysicsAsync;
+}
+
+FHitReactAsyncCallback* FHitReactAsyncCallback::Register(const UWorld* World)
+{
+	FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+	Chaos::FPBDRigidsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+	return Solver ? Solver->CreateAndRegisterSimCallbackObject_External<FHitReactAsyncCallback>() : nullptr;
+}
+
+void FHitReactAsyncCallback::Unregister(const UWorld* World, FHitReactAsyncCallback*& Callback)
+{
+	if (!Callback)
+	{
+		return;
+	}
+
+	FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+	if (Chaos::FPBDRigidsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr)
+	{
+		Solver->UnregisterAndFreeSimCallbackObject_External(Callback);
+	}
+	Callback = nullptr;
+}
+
+FName FHitReactAsyncCallback::GetFNameForStatId() const
+{
+	const static FLazyName StaticName("FHitReactAsyncCallback");
+	return StaticName;
+}
+
+namespace HitReactAsyncPhysics
+{
+	/**
+	 * @return The physics thread handle if the body can receive impulses, waking it if asleep
+	 * Proxies that were removed from the solver since the input was pushed have no handle, and are skipped
+	 */
+	static Chaos::FRigidBodyHandle_Internal* GetDynamicHandle(Chaos::FSingleParticlePhysicsProxy* Proxy)
+	{
+		if (!Proxy || !Proxy->GetHandle_LowLevel())
+		{
+			return nullptr;
+		}
+
+		Chaos::FRigidBodyHandle_Internal* Handle = Proxy->GetPhysicsThreadAPI();
+		if (!Handle)
+		{
+			return nullptr;
+		}
+
+		if (Handle->ObjectState() == Chaos::EObjectStateType::Sleeping)
+		{
+			Handle->SetObjectState(Chaos::EObjectStateType::Dynamic);
+		}
+		return Handle->ObjectState() == Chaos::EObjectStateType::Dynamic ? Handle : nullptr;
+	}
+
+	static FVector GetCenterOfMass(const Chaos::FRigidBodyHandle_Internal* Handle)
+	{
+		return Handle->X() + Handle->R().RotateVector(Handle->CenterOfMass());
+	}
+
+	static void ApplyImpulse(Chaos::FRigidBodyHandle_Internal* Handle, const FVector& LinearVelocity,
+		const FVector& LinearImpulse, const FVector& AngularVelocity, const FVector& AngularImpulse)
+	{
+		if (!LinearVelocity.IsZero() || !LinearImpulse.IsZero())
+		{
+			Handle->SetV(Handle->V() + LinearVelocity + LinearImpulse * Handle->InvM());
+		}
+
+		if (!AngularVelocity.IsZero() || !AngularImpulse.IsZero())
+		{
+			FVector DeltaW = AngularVelocity;
+			if (!AngularImpulse.IsZero())
+			{
+				const Chaos::FMatrix33 WorldInvI = Chaos::Utilities::ComputeWorldSpaceInertia(
+					Handle->R() * Handle->RotationOfMass(), Handle->InvI());
+				DeltaW += Chaos::Utilities::Multiply(WorldInvI, AngularImpulse);
+			}
+			Handle->SetW(Handle->W() + DeltaW);
+		}
+	}
+}
+
+void FHitReactAsyncCallback::OnPreSimulate_Internal()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactAsyncCallback::OnPreSimulate_Internal);
+
+	const FHitReactAsyncInput* Input = GetConsumerInput_Internal();
+	if (!Input)
+	{
+		return;
+	}
+
+	for (const FHitReactAsyncBodyImpulse& Body : Input->BodyImpulses)
+	{
+		if (Chaos::FRigidBodyHandle_Internal* Handle = HitReactAsyncPhysics::GetDynamicHandle(Body.Proxy))
+		{
+			HitReactAsyncPhysics::ApplyImpulse(Handle, Body.LinearVelocity, Body.LinearImpulse,
+				Body.AngularVelocity, Body.AngularImpulse);
+		}
+	}
+
+	// Matches FBodyInstance::AddRadialImpulseToBody
+	for (const FHitReactAsyncRadialImpulse& Radial : Input->RadialImpulses)
+	{
+		for (int32 i = Radial.FirstProxy; i < Radial.FirstProxy + Radial.NumProxies; i++)
+		{
+			Chaos::FRigidBodyHandle_Internal* Handle = HitReactAsyncPhysics::GetDynamicHandle(Input->RadialProxies[i]);
+			if (!Handle)
+			{
+				continue;
+			}
+
+			FVector Delta = HitReactAsyncPhysics::GetCenterOfMass(Handle) - Radial.Origin;
+			const float Distance = Delta.Size();
+			if (Distance > Radial.Radius)
+			{
+				continue;
+			}
+
+			Delta.Normalize();
+			float Strength = Radial.Strength;
+			if (Radial.Falloff == RIF_Linear)
+			{
+				Strength *= 1.f - Distance / Radial.Radius;
+			}
+
+			const FVector Impulse = Delta * Strength;
+			HitReactAsyncPhysics::ApplyImpulse(Handle, Radial.bVelocityChange ? Impulse : FVector::ZeroVector,
+				Radial.bVelocityChange ? FVector::ZeroVector : Impulse, FVector::ZeroVector, FVector::ZeroVector);
+		}
+	}
+}
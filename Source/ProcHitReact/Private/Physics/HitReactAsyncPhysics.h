@@ -0,0 +1,103 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/SimCallbackInput.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Engine/EngineTypes.h"
+
+class USkeletalMeshComponent;
+class UWorld;
+struct FBodyInstance;
+
+namespace Chaos
+{
+	class FSingleParticlePhysicsProxy;
+}
+
+/**
+ * Impulses coalesced for a single body during a frame
+ * Mass dependent impulses are converted to velocity on the physics thread, where the mass properties live
+ */
+struct FHitReactAsyncBodyImpulse
+{
+	Chaos::FSingleParticlePhysicsProxy* Proxy = nullptr;
+
+	/** Linear impulse applied as a velocity change */
+	FVector LinearVelocity = FVector::ZeroVector;
+
+	/** Linear impulse scaled by the body's inverse mass */
+	FVector LinearImpulse = FVector::ZeroVector;
+
+	/** Angular impulse applied as a velocity change, in radians */
+	FVector AngularVelocity = FVector::ZeroVector;
+
+	/** Angular impulse scaled by the body's world space inverse inertia, in radians */
+	FVector AngularImpulse = FVector::ZeroVector;
+};
+
+/**
+ * Radial impulse applied to a range of FHitReactAsyncInput::RadialProxies
+ * The falloff is evaluated against each body's center of mass on the physics thread
+ */
+struct FHitReactAsyncRadialImpulse
+{
+	FVector Origin = FVector::ZeroVector;
+	float Radius = 0.f;
+	float Strength = 0.f;
+	TEnumAsByte<ERadialImpulseFalloff> Falloff = RIF_Constant;
+	bool bVelocityChange = false;
+	int32 FirstProxy = 0;
+	int32 NumProxies = 0;
+};
+
+/**
+ * Everything a single UHitReact pushes to the physics thread for a frame
+ * Inputs are pooled by the solver, so the arrays keep their allocations between frames
+ * Proxies are only valid while the mesh has physics state, UHitReact::OnMeshPhysicsStateChanged resets the input
+ * before it can be pushed along with their removal
+ */
+struct FHitReactAsyncInput : public Chaos::FSimCallbackInput
+{
+	TArray<FHitReactAsyncBodyImpulse> BodyImpulses;
+	TArray<FHitReactAsyncRadialImpulse> RadialImpulses;
+	TArray<Chaos::FSingleParticlePhysicsProxy*> RadialProxies;
+
+	void Reset()
+	{
+		BodyImpulses.Reset();
+		RadialImpulses.Reset();
+		RadialProxies.Reset();
+	}
+
+	/** @return The coalesced impulse for the body, or nullptr if the body has no physics state */
+	FHitReactAsyncBodyImpulse* FindOrAddBody(const FBodyInstance* BI);
+
+	void AddImpulse(const FBodyInstance* BI, const FVector& Impulse, bool bVelocityChange);
+	void AddAngularImpulseInRadians(const FBodyInstance* BI, const FVector& Impulse, bool bVelocityChange);
+	void AddRadialImpulse(const USkeletalMeshComponent* Mesh, const FVector& Origin, float Radius, float Strength,
+		ERadialImpulseFalloff Falloff, bool bVelocityChange);
+};
+
+/**
+ * Applies the impulses pushed by a UHitReact in a single pass on the physics thread
+ * Only used when the world ticks physics asynchronously, see UHitReact::bUseAsyncPhysics
+ */
+class FHitReactAsyncCallback : public Chaos::TSimCallbackObject<FHitReactAsyncInput>
+{
+public:
+	/** @return True if World ticks physics asynchronously and p.HitReact.AsyncPhysics is enabled */
+	static bool IsAvailable(const UWorld* World);
+
+	/** Create and register a callback with World's physics solver */
+	static FHitReactAsyncCallback* Register(const UWorld* World);
+
+	/** Unregister and free a callback created by Register, Callback is reset to nullptr */
+	static void Unregister(const UWorld* World, FHitReactAsyncCallback*& Callback);
+
+	virtual FName GetFNameForStatId() const override;
+
+protected:
+	virtual void OnPreSimulate_Internal() override;
+};
@@ -0,0 +1,333 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactBlendEvaluator.h"
+
+#include "HitReactProfile.h"
+#include "Physics/HitReactPhysics.h"
+#include "Math/VectorRegister.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+namespace HitReactBlendEvaluator
+{
+	/** Number of lanes evaluated at a time */
+	static constexpr int32 LaneWidth = 4;
+
+	/** Easing that can be evaluated in vector registers, stored as floats so lanes can be compared in-register */
+	namespace EEase
+	{
+		static constexpr float Linear = 0.f;
+		static constexpr float Hermite = 1.f;
+		static constexpr float QuadraticInOut = 2.f;
+		static constexpr float CubicInOut = 3.f;
+	}
+
+	/** @return True if the blend can be eased in vector registers */
+	static bool GetVectorEase(const FHitReactBlendParams& Params, float& OutEase)
+	{
+		// Never evaluated when there is no blend time
+		if (Params.BlendTime <= 0.f)
+		{
+			OutEase = EEase::Linear;
+			return true;
+		}
+
+		switch (Params.BlendOption)
+		{
+		case EAlphaBlendOption::Linear: OutEase = EEase::Linear; return true;
+		case EAlphaBlendOption::Cubic:  // CubicInterp(0, 0, 1, 0) is equivalent to SmoothStep(0, 1)
+		case EAlphaBlendOption::HermiteCubic: OutEase = EEase::Hermite; return true;
+		case EAlphaBlendOption::QuadraticInOut: OutEase = EEase::QuadraticInOut; return true;
+		case EAlphaBlendOption::CubicInOut: OutEase = EEase::CubicInOut; return true;
+		default: return false;
+		}
+	}
+
+	/** Vectorized FAlphaBlend::AlphaToBlendOption() for the easing in EEase, Alpha must be within 0-1 */
+	static FORCEINLINE VectorRegister4Float VectorEase(const VectorRegister4Float& Alpha, const VectorRegister4Float& Ease)
+	{
+		const VectorRegister4Float One = VectorOneFloat();
+		const VectorRegister4Float Two = VectorSetFloat1(2.f);
+		const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+		// SmoothStep: A^2 * (3 - 2A)
+		const VectorRegister4Float Hermite = VectorMultiply(VectorMultiply(Alpha, Alpha),
+			VectorSubtract(VectorSetFloat1(3.f), VectorMultiply(Two, Alpha)));
+
+		// InterpEaseInOut: 0.5 * (2A)^N below the midpoint, 1 - 0.5 * (2 - 2A)^N above it
+		const VectorRegister4Float LowerHalf = VectorCompareLT(Alpha, Half);
+		const VectorRegister4Float Base = VectorMultiply(Two, VectorSelect(LowerHalf, Alpha, VectorSubtract(One, Alpha)));
+		const VectorRegister4Float Squared = VectorMultiply(VectorMultiply(Base, Base), Half);
+		const VectorRegister4Float Cubed = VectorMultiply(Squared, Base);
+		const VectorRegister4Float Quadratic = VectorSelect(LowerHalf, Squared, VectorSubtract(One, Squared));
+		const VectorRegister4Float Cubic = VectorSelect(LowerHalf, Cubed, VectorSubtract(One, Cubed));
+
+		VectorRegister4Float Result = Alpha;
+		Result = VectorSelect(VectorCompareEQ(Ease, VectorSetFloat1(EEase::Hermite)), Hermite, Result);
+		Result = VectorSelect(VectorCompareEQ(Ease, VectorSetFloat1(EEase::QuadraticInOut)), Quadratic, Result);
+		Result = VectorSelect(VectorCompareEQ(Ease, VectorSetFloat1(EEase::CubicInOut)), Cubic, Result);
+		return Result;
+	}
+
+	static FORCEINLINE VectorRegister4Float VectorSaturate(const VectorRegister4Float& Value)
+	{
+		return VectorMin(VectorMax(Value, VectorZeroFloat()), VectorOneFloat());
+	}
+}
+
+void FHitReactBlendEvaluator::Build(const TArray<FHitReactPhysics>& Blends)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBlendEvaluator::Build);
+
+	using namespace HitReactBlendEvaluator;
+
+	NumBlends = Blends.Num();
+	NumScalarLanes = 0;
+
+	// Padded lanes have no total time, so they are always completed with no weight
+	// Reset retains the allocations, so rebuilding doesn't touch the allocator once warmed up
+	const int32 NumLanes = Align(NumBlends, LaneWidth);
+	for (TArray<float>* Lanes : { &ElapsedTime, &BlendInTime, &HoldEndTime, &BlendOutTime, &TotalTime,
+		&BlendInEase, &BlendOutEase, &MaxBlendWeight, &BlendWeight })
+	{
+		Lanes->Reset();
+		Lanes->AddZeroed(NumLanes);
+	}
+	ScalarLanes.Reset();
+	ScalarLanes.Add(false, NumBlends);
+
+	for (int32 Index = 0; Index < NumBlends; Index++)
+	{
+		const FHitReactPhysics& Physics = Blends[Index];
+		const FHitReactPhysicsState& State = Physics.PhysicsState;
+		const FHitReactPhysicsStateParams& Params = State.Params;
+
+		float InEase = EEase::Linear;
+		float OutEase = EEase::Linear;
+		if (!Physics.Profile || !State.IsActive() || State.IsDecaying() ||
+			!GetVectorEase(Params.BlendIn, InEase) || !GetVectorEase(Params.BlendOut, OutEase))
+		{
+			ScalarLanes[Index] = true;
+			NumScalarLanes++;
+			continue;
+		}
+
+		ElapsedTime[Index] = State.GetElapsedTime();
+		BlendInTime[Index] = Params.BlendIn.BlendTime;
+		HoldEndTime[Index] = Params.BlendIn.BlendTime + Params.BlendHoldTime;
+		BlendOutTime[Index] = Params.BlendOut.BlendTime;
+		TotalTime[Index] = Params.GetTotalTime();
+		BlendInEase[Index] = InEase;
+		BlendOutEase[Index] = OutEase;
+		MaxBlendWeight[Index] = Physics.Profile->MaxBlendWeight;
+	}
+}
+
+void FHitReactBlendEvaluator::Evaluate(float DeltaTime, TArray<FHitReactPhysics>& Blends)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBlendEvaluator::Evaluate);
+
+	using namespace HitReactBlendEvaluator;
+
+	check(Blends.Num() == NumBlends);
+
+	const VectorRegister4Float Delta = VectorSetFloat1(DeltaTime);
+	const VectorRegister4Float MinBlendTime = VectorSetFloat1(UE_SMALL_NUMBER);
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+
+	const int32 NumLanes = ElapsedTime.Num();
+	for (int32 Lane = 0; Lane < NumLanes; Lane += LaneWidth)
+	{
+		// Advance the elapsed time
+		const VectorRegister4Float Total = VectorLoad(&TotalTime[Lane]);
+		const VectorRegister4Float Elapsed = VectorMin(VectorAdd(VectorLoad(&ElapsedTime[Lane]), Delta), Total);
+		VectorStore(Elapsed, &ElapsedTime[Lane]);
+
+		// Ease both blend segments, only one is selected
+		const VectorRegister4Float InTime = VectorLoad(&BlendInTime[Lane]);
+		const VectorRegister4Float HoldEnd = VectorLoad(&HoldEndTime[Lane]);
+		const VectorRegister4Float InAlpha = VectorSaturate(VectorDivide(Elapsed, VectorMax(InTime, MinBlendTime)));
+		const VectorRegister4Float OutAlpha = VectorSaturate(VectorDivide(VectorSubtract(Elapsed, HoldEnd),
+			VectorMax(VectorLoad(&BlendOutTime[Lane]), MinBlendTime)));
+		const VectorRegister4Float InWeight = VectorEase(InAlpha, VectorLoad(&BlendInEase[Lane]));
+		const VectorRegister4Float OutWeight = VectorSubtract(One, VectorEase(OutAlpha, VectorLoad(&BlendOutEase[Lane])));
+
+		// Select the weight for the state each lane is in, completed lanes have no weight
+		VectorRegister4Float Weight = VectorSelect(VectorCompareLT(Elapsed, Total), OutWeight, Zero);
+		Weight = VectorSelect(VectorCompareLT(Elapsed, HoldEnd), One, Weight);
+		Weight = VectorSelect(VectorCompareLT(Elapsed, InTime), InWeight, Weight);
+		VectorStore(VectorMin(Weight, VectorLoad(&MaxBlendWeight[Lane])), &BlendWeight[Lane]);
+	}
+
+	// Write the results to the physics blends, which remain the source of truth for Blueprint and debugging
+	LowestWeightCandidates.Reset();
+	FurthestBlendOutCandidates.Reset();
+	for (int32 Index = 0; Index < NumBlends; Index++)
+	{
+		FHitReactPhysics& Physics = Blends[Index];
+		if (NumScalarLanes > 0 && ScalarLanes[Index])
+		{
+			Physics.Tick(DeltaTime);
+		}
+		else
+		{
+			Physics.SetEvaluatedState(ElapsedTime[Index], BlendWeight[Index]);
+		}
+
+		// Track the eviction candidates while we're here
+		if (!Physics.IsActive())
+		{
+			continue;
+		}
+		LowestWeightCandidates.Add(Physics.Handle, Physics.RequestedBlendWeight);
+		if (Physics.PhysicsState.GetBlendState() == EHitReactBlendState::BlendOut)
+		{
+			// Negated so the heap yields the furthest along first
+			const float BlendOutTime = Physics.PhysicsState.GetTotalStateTime();
+			const float BlendOutAlpha = BlendOutTime > 0.f ? Physics.PhysicsState.GetElapsedStateTime() / BlendOutTime : 1.f;
+			FurthestBlendOutCandidates.Add(Physics.Handle, -BlendOutAlpha);
+		}
+	}
+}
+
+void FHitReactBlendEvaluator::Reset()
+{
+	NumBlends = 0;
+	NumScalarLanes = 0;
+	LowestWeightCandidates.Reset();
+	FurthestBlendOutCandidates.Reset();
+	for (TArray<float>* Lanes : { &ElapsedTime, &BlendInTime, &HoldEndTime, &BlendOutTime, &TotalTime,
+		&BlendInEase, &BlendOutEase, &MaxBlendWeight, &BlendWeight })
+	{
+		Lanes->Reset();
+	}
+	ScalarLanes.Reset();
+}
+
+void FHitReactBodyBlendWeights::Begin(const TArray<FBodyInstance*>& Bodies, float InDeltaTime, bool bInPerBodyBlendRate,
+	float InBlendRate)
+{
+	using namespace HitReactBlendEvaluator;
+
+	// The blend factor is constant for this tick unless each body blends at its own rate
+	DeltaTime = InDeltaTime;
+	bPerBodyBlendRate = bInPerBodyBlendRate;
+	BlendFactor = bPerBodyBlendRate ? 0.f : 1.f - FMath::Exp(-InBlendRate * DeltaTime);
+	BlendBodies.Reset();
+	BlendTargets.Reset();
+	BlendOffsets.Reset();
+
+	// Padded bodies have no weight and are never read
+	const int32 NumBodies = Align(Bodies.Num(), LaneWidth);
+	BlendWeight.Reset();
+	BlendWeight.AddUninitialized(NumBodies);
+	RetainedWeight.Reset();
+	RetainedWeight.AddUninitialized(NumBodies);
+	TargetWeight.Reset();
+	TargetWeight.AddUninitialized(NumBodies);
+	if (bPerBodyBlendRate)
+	{
+		BodyBlendRate.Reset();
+		BodyBlendRate.AddZeroed(NumBodies);
+		BodyMaxTarget.Reset();
+		BodyMaxTarget.AddUninitialized(NumBodies);
+		for (float& MaxTarget : BodyMaxTarget)
+		{
+			MaxTarget = -1.f;
+		}
+	}
+
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex++)
+	{
+		const FBodyInstance* BI = Bodies.IsValidIndex(BodyIndex) ? Bodies[BodyIndex] : nullptr;
+		BlendWeight[BodyIndex] = BI ? BI->PhysicsBlendWeight : 0.f;
+		RetainedWeight[BodyIndex] = 1.f;
+		TargetWeight[BodyIndex] = 0.f;
+	}
+}
+
+void FHitReactBodyBlendWeights::BeginBlend()
+{
+	BlendOffsets.Add(BlendBodies.Num());
+}
+
+void FHitReactBodyBlendWeights::AddTarget(int32 BodyIndex, float InTargetWeight, float BlendRate)
+{
+	BlendBodies.Add(BodyIndex);
+
+	// The rate isn't known until every target is gathered, fold them in Resolve() instead
+	if (bPerBodyBlendRate)
+	{
+		BlendTargets.Add(InTargetWeight);
+		if (InTargetWeight > BodyMaxTarget[BodyIndex])
+		{
+			BodyMaxTarget[BodyIndex] = InTargetWeight;
+			BodyBlendRate[BodyIndex] = BlendRate;
+		}
+		return;
+	}
+
+	// Successive Lerp(Weight, Target, BlendFactor) reduce to Weight * Retained + Target, so they can be resolved at once
+	TargetWeight[BodyIndex] += (InTargetWeight - TargetWeight[BodyIndex]) * BlendFactor;
+	RetainedWeight[BodyIndex] *= 1.f - BlendFactor;
+}
+
+void FHitReactBodyBlendWeights::Resolve()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodyBlendWeights::Resolve);
+
+	using namespace HitReactBlendEvaluator;
+
+	const int32 NumBodies = BlendWeight.Num();
+
+	// Fold the targets in the order they were gathered, using the blend factor of each body
+	if (bPerBodyBlendRate)
+	{
+		for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex++)
+		{
+			BodyBlendRate[BodyIndex] = 1.f - FMath::Exp(-BodyBlendRate[BodyIndex] * DeltaTime);
+		}
+		for (int32 Index = 0; Index < BlendBodies.Num(); Index++)
+		{
+			const int32 BodyIndex = BlendBodies[Index];
+			const float BodyBlendFactor = BodyBlendRate[BodyIndex];
+			TargetWeight[BodyIndex] += (BlendTargets[Index] - TargetWeight[BodyIndex]) * BodyBlendFactor;
+			RetainedWeight[BodyIndex] *= 1.f - BodyBlendFactor;
+		}
+	}
+
+	for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex += LaneWidth)
+	{
+		const VectorRegister4Float Weight = VectorMultiplyAdd(VectorLoad(&BlendWeight[BodyIndex]),
+			VectorLoad(&RetainedWeight[BodyIndex]), VectorLoad(&TargetWeight[BodyIndex]));
+		VectorStore(VectorSaturate(Weight), &BlendWeight[BodyIndex]);
+	}
+}
+
+bool FHitReactBodyBlendWeights::HasBlendWeight(int32 BlendIndex, float Tolerance) const
+{
+	const int32 Start = BlendOffsets[BlendIndex];
+	const int32 End = BlendOffsets.IsValidIndex(BlendIndex + 1) ? BlendOffsets[BlendIndex + 1] : BlendBodies.Num();
+	for (int32 Index = Start; Index < End; Index++)
+	{
+		if (!FMath::IsNearlyZero(BlendWeight[BlendBodies[Index]], Tolerance))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FHitReactBodyBlendWeights::Reset()
+{
+	BlendFactor = 0.f;
+	BlendWeight.Reset();
+	RetainedWeight.Reset();
+	TargetWeight.Reset();
+	BlendBodies.Reset();
+	BlendTargets.Reset();
+	BodyBlendRate.Reset();
+	BodyMaxTarget.Reset();
+	BlendOffsets.Reset();
+}
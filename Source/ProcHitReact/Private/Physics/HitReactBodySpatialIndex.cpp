@@ -0,0 +1,181 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactBodySpatialIndex.h"
+
+#include "Algo/Sort.h"
+#include "PhysicsEngine/BodyInstance.h"
+
+namespace HitReactBodySpatialIndex
+{
+	/** Maximum number of bodies in a leaf, physics assets are small so a shallow hierarchy is sufficient */
+	static constexpr int32 MaxLeafBodies = 2;
+}
+
+void FHitReactBodySpatialIndex::Update(const TArray<FBodyInstance*>& Bodies)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodySpatialIndex::Update);
+
+	const bool bRebuild = BodyBounds.Num() != Bodies.Num() || Nodes.Num() == 0;
+	if (!bRebuild && UpdateFrame == GFrameCounter)
+	{
+		return;
+	}
+	UpdateFrame = GFrameCounter;
+
+	// Gather the current bounds of each body
+	BodyBounds.Reset();
+	BodyBounds.AddUninitialized(Bodies.Num());
+	for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+	{
+		const FBodyInstance* BI = Bodies[BodyIndex];
+		BodyBounds[BodyIndex] = BI ? BI->GetBodyBounds() : FBox(ForceInit);
+	}
+
+	// The topology only depends on which bodies exist, a poor fit after they move makes queries slower but not wrong
+	if (bRebuild)
+	{
+		BodyIndices.Reset();
+		for (int32 BodyIndex = 0; BodyIndex < Bodies.Num(); BodyIndex++)
+		{
+			if (Bodies[BodyIndex])
+			{
+				BodyIndices.Add(BodyIndex);
+			}
+		}
+
+		Nodes.Reset();
+		if (BodyIndices.Num() > 0)
+		{
+			Nodes.AddDefaulted();
+			BuildNode(0, 0, BodyIndices.Num());
+		}
+		return;
+	}
+
+	// Refit in reverse, children always follow their parent
+	for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; NodeIndex--)
+	{
+		FNode& Node = Nodes[NodeIndex];
+		if (Node.FirstChild == INDEX_NONE)
+		{
+			Node.Bounds = FBox(ForceInit);
+			for (int32 Index = Node.FirstBody; Index < Node.FirstBody + Node.NumBodies; Index++)
+			{
+				Node.Bounds += BodyBounds[BodyIndices[Index]];
+			}
+		}
+		else
+		{
+			Node.Bounds = Nodes[Node.FirstChild].Bounds + Nodes[Node.FirstChild + 1].Bounds;
+		}
+	}
+}
+
+void FHitReactBodySpatialIndex::BuildNode(int32 NodeIndex, int32 FirstBody, int32 NumBodies)
+{
+	FBox Bounds(ForceInit);
+	FBox Centers(ForceInit);
+	for (int32 Index = FirstBody; Index < FirstBody + NumBodies; Index++)
+	{
+		const FBox& Body = BodyBounds[BodyIndices[Index]];
+		if (Body.IsValid)
+		{
+			Bounds += Body;
+			Centers += Body.GetCenter();
+		}
+	}
+	Nodes[NodeIndex].Bounds = Bounds;
+
+	if (NumBodies <= HitReactBodySpatialIndex::MaxLeafBodies)
+	{
+		Nodes[NodeIndex].FirstBody = FirstBody;
+		Nodes[NodeIndex].NumBodies = NumBodies;
+		return;
+	}
+
+	// Split at the median along the axis the body centers are most spread out on
+	const FVector Extent = Centers.IsValid ? Centers.GetSize() : FVector::ZeroVector;
+	const int32 Axis = Extent.X >= Extent.Y && Extent.X >= Extent.Z ? 0 : Extent.Y >= Extent.Z ? 1 : 2;
+	TArrayView<int32> Range(BodyIndices.GetData() + FirstBody, NumBodies);
+	Algo::Sort(Range, [this, Axis](int32 A, int32 B)
+	{
+		return BodyBounds[A].GetCenter()[Axis] < BodyBounds[B].GetCenter()[Axis];
+	});
+
+	const int32 FirstChild = Nodes.AddDefaulted(2);
+	Nodes[NodeIndex].FirstChild = FirstChild;
+
+	const int32 NumLeft = NumBodies / 2;
+	BuildNode(FirstChild, FirstBody, NumLeft);
+	BuildNode(FirstChild + 1, FirstBody + NumLeft, NumBodies - NumLeft);
+}
+
+int32 FHitReactBodySpatialIndex::FindNearestBody(const TArray<FBodyInstance*>& Bodies, const FVector& Location,
+	float MaxDistance, const TFunctionRef<bool(int32 BodyIndex)>& IsBodyValid) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactBodySpatialIndex::FindNearestBody);
+
+	if (Nodes.Num() == 0 || BodyBounds.Num() != Bodies.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	int32 NearestBody = INDEX_NONE;
+	FVector::FReal NearestDistSq = FMath::Square(static_cast<FVector::FReal>(MaxDistance));
+
+	TArray<int32, TInlineAllocator<32>> Stack;
+	Stack.Add(0);
+	while (Stack.Num() > 0)
+	{
+		const FNode& Node = Nodes[Stack.Pop()];
+		if (!Node.Bounds.IsValid || Node.Bounds.ComputeSquaredDistanceToPoint(Location) > NearestDistSq)
+		{
+			continue;  // Nothing in here can be nearer
+		}
+
+		if (Node.FirstChild != INDEX_NONE)
+		{
+			// Visit the nearer child first, so more of the further child is culled
+			const FNode& A = Nodes[Node.FirstChild];
+			const FNode& B = Nodes[Node.FirstChild + 1];
+			const bool bANearer = A.Bounds.IsValid && (!B.Bounds.IsValid ||
+				A.Bounds.ComputeSquaredDistanceToPoint(Location) <= B.Bounds.ComputeSquaredDistanceToPoint(Location));
+			Stack.Add(bANearer ? Node.FirstChild + 1 : Node.FirstChild);
+			Stack.Add(bANearer ? Node.FirstChild : Node.FirstChild + 1);
+			continue;
+		}
+
+		for (int32 Index = Node.FirstBody; Index < Node.FirstBody + Node.NumBodies; Index++)
+		{
+			const int32 BodyIndex = BodyIndices[Index];
+			const FBox& Bounds = BodyBounds[BodyIndex];
+			if (!Bounds.IsValid || Bounds.ComputeSquaredDistanceToPoint(Location) > NearestDistSq || !IsBodyValid(BodyIndex))
+			{
+				continue;
+			}
+
+			// Measure against the collision geometry, falling back to the bounds if the body has none
+			float DistSq = 0.f;
+			FVector PointOnBody;
+			const FVector::FReal BodyDistSq = Bodies[BodyIndex]->GetSquaredDistanceToBody(Location, DistSq, PointOnBody) ?
+				DistSq : Bounds.ComputeSquaredDistanceToPoint(Location);
+
+			if (BodyDistSq <= NearestDistSq)
+			{
+				NearestBody = BodyIndex;
+				NearestDistSq = BodyDistSq;
+			}
+		}
+	}
+
+	return NearestBody;
+}
+
+void FHitReactBodySpatialIndex::Reset()
+{
+	Nodes.Reset();
+	BodyIndices.Reset();
+	BodyBounds.Reset();
+	UpdateFrame = 0;
+}
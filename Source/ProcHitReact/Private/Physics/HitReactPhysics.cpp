@@ -9,20 +9,18 @@
 #include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactPhysics)
 
 
-void FHitReactPhysics::HitReact(USkeletalMeshComponent* InMesh, const TObjectPtr<const UHitReactProfile>& InProfile,
-	const FName& BoneName, const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars)
+void FHitReactPhysics::HitReact(const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName,
+	const TSharedPtr<const FHitReactBoneOverrides>& InBoneOverrides)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactPhysics::HitReact);
 
 	// Reset physics states
 	PhysicsState = {};
 	
-	// Assign properties
-	Mesh = InMesh;
+	// Assign properties, the bone overrides are shared rather than copied
 	SimulatedBoneName = BoneName;
 	Profile = InProfile;
-	DisabledBones = InDisabledBones;
-	BoneWeightScalars = InBoneWeightScalars;
+	BoneOverrides = InBoneOverrides;
 
 	// Activate the physics state
 	PhysicsState.Params = Profile->BlendParams;
@@ -68,6 +66,13 @@ void FHitReactPhysics::Tick(float DeltaTime)
 	RequestedBlendWeight = FMath::Min<float>(BlendWeight, MaxBlendWeight);
 }
 
+void FHitReactPhysics::SetEvaluatedState(float ElapsedTime, float BlendWeight)
+{
+	PhysicsState.SetElapsedTime(ElapsedTime);
+	MaxBlendWeight = Profile->MaxBlendWeight;
+	RequestedBlendWeight = BlendWeight;
+}
+
 bool FHitReactPhysics::IsActive() const
 {
 	return PhysicsState.IsActive();
@@ -0,0 +1,182 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Physics/HitReactPhysicsPool.h"
+
+
+void FHitReactPhysicsPool::Init(int32 Capacity, TArray<FHitReactPhysics>& Blends)
+{
+	Capacity = FMath::Max(1, Capacity);
+
+	Blends.Reset();
+	Blends.Reserve(Capacity);
+
+	BlendIndices.Init(INDEX_NONE, Capacity);
+	Generations.SetNumZeroed(Capacity);
+	FreeSlots.SetNumZeroed(Capacity);
+	NextSlots.Init(INDEX_NONE, Capacity);
+	PrevSlots.Init(INDEX_NONE, Capacity);
+	ReleaseAll();
+}
+
+FHitReactPhysicsHandle FHitReactPhysicsPool::Allocate(int32 BlendIndex)
+{
+	if (NumFreeSlots == 0)
+	{
+		return {};
+	}
+
+	const int32 Slot = FreeSlots[--NumFreeSlots];
+	BlendIndices[Slot] = BlendIndex;
+
+	// Link as the newest slot
+	PrevSlots[Slot] = NewestSlot;
+	NextSlots[Slot] = INDEX_NONE;
+	if (NewestSlot != INDEX_NONE)
+	{
+		NextSlots[NewestSlot] = Slot;
+	}
+	else
+	{
+		OldestSlot = Slot;
+	}
+	NewestSlot = Slot;
+
+	FHitReactPhysicsHandle Handle;
+	Handle.Slot = Slot;
+	Handle.Generation = Generations[Slot];
+	return Handle;
+}
+
+void FHitReactPhysicsPool::Release(const FHitReactPhysicsHandle& Handle)
+{
+	if (Find(Handle) == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 Slot = Handle.Slot;
+	BlendIndices[Slot] = INDEX_NONE;
+	Generations[Slot]++;
+	FreeSlots[NumFreeSlots++] = Slot;
+
+	// Unlink
+	const int32 PrevSlot = PrevSlots[Slot];
+	const int32 NextSlot = NextSlots[Slot];
+	if (PrevSlot != INDEX_NONE)
+	{
+		NextSlots[PrevSlot] = NextSlot;
+	}
+	else
+	{
+		OldestSlot = NextSlot;
+	}
+	if (NextSlot != INDEX_NONE)
+	{
+		PrevSlots[NextSlot] = PrevSlot;
+	}
+	else
+	{
+		NewestSlot = PrevSlot;
+	}
+	PrevSlots[Slot] = INDEX_NONE;
+	NextSlots[Slot] = INDEX_NONE;
+}
+
+void FHitReactPhysicsPool::ReleaseAll()
+{
+	NumFreeSlots = 0;
+	OldestSlot = INDEX_NONE;
+	NewestSlot = INDEX_NONE;
+
+	// Added in reverse so the lowest slots are allocated first
+	for (int32 Slot = BlendIndices.Num() - 1; Slot >= 0; Slot--)
+	{
+		if (BlendIndices[Slot] != INDEX_NONE)
+		{
+			BlendIndices[Slot] = INDEX_NONE;
+			Generations[Slot]++;
+		}
+		PrevSlots[Slot] = INDEX_NONE;
+		NextSlots[Slot] = INDEX_NONE;
+		FreeSlots[NumFreeSlots++] = Slot;
+	}
+}
+
+void FHitReactPhysicsPool::Remap(const TArray<FHitReactPhysics>& Blends)
+{
+	for (int32 BlendIndex = 0; BlendIndex < Blends.Num(); BlendIndex++)
+	{
+		const FHitReactPhysicsHandle& Handle = Blends[BlendIndex].Handle;
+		if (BlendIndices.IsValidIndex(Handle.Slot))
+		{
+			BlendIndices[Handle.Slot] = BlendIndex;
+		}
+	}
+}
+
+void FHitReactPhysicsPool::Relocate(const FHitReactPhysicsHandle& Handle, int32 BlendIndex)
+{
+	if (Find(Handle) != INDEX_NONE)
+	{
+		BlendIndices[Handle.Slot] = BlendIndex;
+	}
+}
+
+int32 FHitReactPhysicsPool::Find(const FHitReactPhysicsHandle& Handle) const
+{
+	if (!BlendIndices.IsValidIndex(Handle.Slot) || Generations[Handle.Slot] != Handle.Generation)
+	{
+		return INDEX_NONE;
+	}
+	return BlendIndices[Handle.Slot];
+}
+
+FHitReactPhysicsHandle FHitReactPhysicsPool::GetOldest() const
+{
+	FHitReactPhysicsHandle Handle;
+	if (OldestSlot != INDEX_NONE)
+	{
+		Handle.Slot = OldestSlot;
+		Handle.Generation = Generations[OldestSlot];
+	}
+	return Handle;
+}
+
+void FHitReactEvictionCandidates::Reset()
+{
+	Candidates.Reset();
+	bHeap = false;
+}
+
+void FHitReactEvictionCandidates::Add(const FHitReactPhysicsHandle& Handle, float Priority)
+{
+	Candidates.Add({ Handle, Priority });
+	bHeap = false;
+}
+
+FHitReactPhysicsHandle FHitReactEvictionCandidates::Pop(const FHitReactPhysicsPool& Pool)
+{
+	auto Predicate = [](const FCandidate& A, const FCandidate& B)
+	{
+		return A.Priority < B.Priority;
+	};
+
+	// Most ticks never evict, so only pay for the heap when we do
+	if (!bHeap)
+	{
+		Candidates.Heapify(Predicate);
+		bHeap = true;
+	}
+
+	while (Candidates.Num() > 0)
+	{
+		FCandidate Candidate;
+		Candidates.HeapPop(Candidate, Predicate);
+		if (Pool.Find(Candidate.Handle) != INDEX_NONE)
+		{
+			return Candidate.Handle;
+		}
+	}
+	return {};
+}
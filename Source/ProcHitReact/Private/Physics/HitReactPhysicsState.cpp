@@ -74,6 +74,35 @@ void FHitReactPhysicsState::Finish()
 	ElapsedTime = GetTotalTime();
 }
 
+void FHitReactPhysicsState::Restart()
+{
+	Activate();
+	DecayTime = 0.f;
+}
+
+void FHitReactPhysicsState::ExtendHold()
+{
+	// Blending in already continues into the hold
+	if (ElapsedTime < Params.BlendIn.BlendTime)
+	{
+		return;
+	}
+
+	DecayTime = 0.f;
+	SetElapsedTime(Params.BlendIn.BlendTime);
+}
+
+void FHitReactPhysicsState::Decay()
+{
+	// Can't rewind beyond the start of the blend
+	float MaxDecayTime = ElapsedTime;
+	if (Params.MaxAccumulatedDecayTime > 0.f)
+	{
+		MaxDecayTime = FMath::Min<float>(MaxDecayTime, Params.MaxAccumulatedDecayTime);
+	}
+	DecayTime = FMath::Clamp<float>(DecayTime + Params.DecayTime, 0.f, MaxDecayTime);
+}
+
 float FHitReactPhysicsState::GetBlendTime() const
 {
 	switch (BlendState)
@@ -184,19 +213,15 @@ bool FHitReactPhysicsState::Tick(float DeltaTime)
 	// Process the decay state
 	if (IsDecaying())
 	{
-		const float PrevDecayTime = DecayTime;
-
-		// We want to retain the remaining delta time after decay is clamped, otherwise we'll lose time
-		const float TargetDecayTime = DecayTime - DeltaTime;
-
-		// Clamp the decay time
-		DecayTime = FMath::Clamp<float>(TargetDecayTime, 0.f, Params.MaxAccumulatedDecayTime);
+		// Rewind at DecayRate
+		const float DecayRate = Params.DecayRate > 0.f ? Params.DecayRate : 1.f;
+		const float DecayDelta = FMath::Min<float>(DecayTime, DeltaTime * DecayRate);
+		DecayTime -= DecayDelta;
 
-		// Calculate the remaining delta time after decay
-		DeltaTime = FMath::Max<float>(0.f, TargetDecayTime - DecayTime);
+		// We want to retain the remaining delta time after decay completes, otherwise we'll lose time
+		DeltaTime = FMath::Max<float>(0.f, DeltaTime - DecayDelta / DecayRate);
 
 		// Update the elapsed time to account for the decay
-		const float DecayDelta = PrevDecayTime - DecayTime;
 		SetElapsedTime(ElapsedTime - DecayDelta);
 
 		if (!IsDecaying())
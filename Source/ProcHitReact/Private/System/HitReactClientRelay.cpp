@@ -0,0 +1,123 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactClientRelay.h"
+
+#include "HitReact.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactClientRelay)
+
+/** Larger unreliable RPCs are split across several bunches and lost entirely if any is, hit reacts beyond this are dropped */
+static constexpr int32 HitReactMaxRelayedHitsPerFrame = 32;
+
+UHitReactClientRelay::UHitReactClientRelay()
+{
+	// Only ticks on frames that queued hit reacts, after everything that may have broadcast one
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_LastDemotable;
+	SetIsReplicatedByDefault(true);
+}
+
+UHitReactClientRelay* UHitReactClientRelay::FindOrAdd(APlayerController* PlayerController)
+{
+	if (!IsValid(PlayerController))
+	{
+		return nullptr;
+	}
+
+	if (UHitReactClientRelay* Relay = PlayerController->FindComponentByClass<UHitReactClientRelay>())
+	{
+		return Relay;
+	}
+
+	UHitReactClientRelay* Relay = NewObject<UHitReactClientRelay>(PlayerController);
+	Relay->RegisterComponent();
+	return Relay;
+}
+
+void UHitReactClientRelay::AddToRemotePlayers(const UWorld* World)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		// Local players apply hit reacts directly and never need a relay
+		APlayerController* PlayerController = It->Get();
+		if (IsValid(PlayerController) && !PlayerController->IsLocalController())
+		{
+			FindOrAdd(PlayerController);
+		}
+	}
+}
+
+void UHitReactClientRelay::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Let the server know it can start sending hit reacts
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		ServerNotifyClientReady();
+	}
+}
+
+void UHitReactClientRelay::ServerNotifyClientReady_Implementation()
+{
+	bClientReady = true;
+}
+
+void UHitReactClientRelay::AddHit(UHitReact* HitReact, const FHitReactQueuedHit& Hit)
+{
+	if (PendingHits.Num() >= HitReactMaxRelayedHitsPerFrame)
+	{
+		return;
+	}
+
+	PendingHits.Emplace(HitReact, Hit);
+	SetComponentTickEnabled(true);
+}
+
+void UHitReactClientRelay::TickComponent(float DeltaTime, ELevelTick TickType,
+	FActorComponentTickFunction* ThisTickFunction)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactClientRelay::TickComponent);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (PendingHits.Num() > 0)
+	{
+		ClientReceiveHitReacts(PendingHits);
+		PendingHits.Reset();
+	}
+	SetComponentTickEnabled(false);
+}
+
+void UHitReactClientRelay::ClientReceiveHitReacts_Implementation(const TArray<FHitReactRelayedHit>& Hits)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactClientRelay::ClientReceiveHitReacts);
+
+	// Consecutive hit reacts for the same component are applied as a batch
+	TArray<FHitReactQueuedHit> ComponentHits;
+	for (int32 i = 0; i < Hits.Num(); i++)
+	{
+		UHitReact* HitReact = Hits[i].HitReact;
+		ComponentHits.Add(Hits[i].Hit);
+		if (Hits.IsValidIndex(i + 1) && Hits[i + 1].HitReact == HitReact)
+		{
+			continue;
+		}
+
+		// The owner may have stopped being relevant since the hit react was sent
+		if (IsValid(HitReact))
+		{
+			HitReact->ReceiveReplicatedHits(ComponentHits);
+		}
+		ComponentHits.Reset();
+	}
+}
@@ -0,0 +1,48 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactNetHits.h"
+
+#include "HitReact.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactNetHits)
+
+void FHitReactNetHitArray::AddHit(const FHitReactQueuedHit& Hit, int32 MaxHits, float StaleTime)
+{
+	// Items are in the order they were added, so anything stale is at the front
+	int32 NumToRemove = 0;
+	while (NumToRemove < Items.Num() && Items[NumToRemove].Hit.HitTime < StaleTime)
+	{
+		NumToRemove++;
+	}
+
+	// Make room for the new hit react by discarding the oldest
+	NumToRemove = FMath::Max(NumToRemove, Items.Num() + 1 - FMath::Max(1, MaxHits));
+	if (NumToRemove > 0)
+	{
+		Items.RemoveAt(0, NumToRemove);
+		MarkArrayDirty();
+	}
+
+	MarkItemDirty(Items.Emplace_GetRef(Hit));
+}
+
+void FHitReactNetHitArray::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
+{
+	if (!OwnerComponent || AddedIndices.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FHitReactQueuedHit> Hits;
+	Hits.Reserve(AddedIndices.Num());
+	for (const int32 Index : AddedIndices)
+	{
+		if (Items.IsValidIndex(Index))
+		{
+			Hits.Add(Items[Index].Hit);
+		}
+	}
+
+	OwnerComponent->ReceiveReplicatedHits(Hits);
+}
@@ -0,0 +1,1383 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "HitReactNetSerializers.h"
+
+#if UE_WITH_IRIS
+#include "Iris/ReplicationState/PropertyNetSerializerInfoRegistry.h"
+#include "Iris/Serialization/NetBitStreamReader.h"
+#include "Iris/Serialization/NetBitStreamUtil.h"
+#include "Iris/Serialization/NetBitStreamWriter.h"
+#include "Iris/Serialization/NetSerializerDelegates.h"
+#include "Iris/Serialization/NetSerializers.h"
+#include "Iris/Serialization/SoftObjectNetSerializers.h"
+#include "Iris/Serialization/StringNetSerializers.h"
+#include "Params/HitReactImpulse.h"
+#include "Params/HitReactTrigger.h"
+#include "System/HitReactNetQuantize.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactNetSerializers)
+
+#if UE_WITH_IRIS
+
+namespace UE::Net
+{
+	namespace HitReactIris
+	{
+		/** Impulse strengths and radii are quantized to a tenth of a unit */
+		static constexpr float FixedPointScale = 10.f;
+
+		/** Enums only use a single bit, Validate() rejects anything else */
+		static constexpr uint32 EnumBits = 1;
+
+		/** Inline storage for the quantized state of nested engine serializers, checked once the registry is frozen */
+		static constexpr SIZE_T NameStorageSize = 64;
+		static constexpr SIZE_T PathStorageSize = 128;
+		static constexpr SIZE_T NestedStorageAlignment = 16;
+
+		FORCEINLINE int32 QuantizeFixed(double Value)
+		{
+			return static_cast<int32>(FMath::Clamp<double>(FMath::RoundToDouble(Value * FixedPointScale), MIN_int32, MAX_int32));
+		}
+
+		FORCEINLINE float DequantizeFixed(int32 Value)
+		{
+			return static_cast<float>(Value) / FixedPointScale;
+		}
+
+		FORCEINLINE uint32 QuantizeOctahedral(const FVector& Direction)
+		{
+			uint16 X = 0;
+			uint16 Y = 0;
+			HitReactNetQuantize::EncodeOctahedral(Direction, X, Y);
+			return (static_cast<uint32>(X) << 16) | Y;
+		}
+
+		FORCEINLINE FVector DequantizeOctahedral(uint32 Value)
+		{
+			return HitReactNetQuantize::DecodeOctahedral(static_cast<uint16>(Value >> 16), static_cast<uint16>(Value & 0xFFFF));
+		}
+
+		/** Full precision, matching FVector::NetSerialize */
+		FORCEINLINE void QuantizeVector(const FVector& Source, uint64 (&Target)[3])
+		{
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				const double Component = Source[Axis];
+				FMemory::Memcpy(&Target[Axis], &Component, sizeof(double));
+			}
+		}
+
+		FORCEINLINE FVector DequantizeVector(const uint64 (&Source)[3])
+		{
+			FVector Result;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				double Component = 0.0;
+				FMemory::Memcpy(&Component, &Source[Axis], sizeof(double));
+				Result[Axis] = Component;
+			}
+			return Result;
+		}
+
+		FORCEINLINE void WriteUint64(FNetBitStreamWriter* Writer, uint64 Value)
+		{
+			Writer->WriteBits(static_cast<uint32>(Value), 32);
+			Writer->WriteBits(static_cast<uint32>(Value >> 32), 32);
+		}
+
+		FORCEINLINE uint64 ReadUint64(FNetBitStreamReader* Reader)
+		{
+			const uint64 Low = Reader->ReadBits(32);
+			const uint64 High = Reader->ReadBits(32);
+			return Low | (High << 32);
+		}
+
+		/** Args for a nested serializer, everything other than the config and values is forwarded from the outer serializer */
+		template<typename ArgsType>
+		FORCEINLINE ArgsType MakeNestedArgs(const ArgsType& Args, NetSerializerConfigParam Config)
+		{
+			ArgsType NestedArgs = Args;
+			NestedArgs.NetSerializerConfig = Config;
+			return NestedArgs;
+		}
+
+		/** Bone indices are bit-packed to the number of bones in the skeleton */
+		FORCEINLINE uint32 GetBoneIndexBits(uint32 NumBones)
+		{
+			return FMath::CeilLogTwo(FMath::Max<uint32>(NumBones, 1));
+		}
+
+		struct FQuantizedImpulse
+		{
+			int32 Impulse;
+			int32 Radius;
+			uint8 bApplyImpulse;
+			uint8 bFactorMass;
+			uint8 EnumValue;  // AngularUnits or Falloff
+
+			bool operator==(const FQuantizedImpulse& Other) const
+			{
+				return Impulse == Other.Impulse && Radius == Other.Radius && bApplyImpulse == Other.bApplyImpulse &&
+					bFactorMass == Other.bFactorMass && EnumValue == Other.EnumValue;
+			}
+		};
+
+		/** Which optional fields an impulse type sends */
+		template<typename T>
+		struct TImpulseLayout
+		{
+			static constexpr bool bHasEnum = false;
+			static constexpr bool bHasRadius = false;
+		};
+
+		template<>
+		struct TImpulseLayout<FHitReactImpulse_Angular>
+		{
+			static constexpr bool bHasEnum = true;
+			static constexpr bool bHasRadius = false;
+		};
+
+		template<>
+		struct TImpulseLayout<FHitReactImpulse_Radial>
+		{
+			static constexpr bool bHasEnum = true;
+			static constexpr bool bHasRadius = true;
+		};
+
+		FORCEINLINE void QuantizeImpulse(const FHitReactImpulse& Source, FQuantizedImpulse& Target)
+		{
+			Target = {};
+			Target.bApplyImpulse = Source.bApplyImpulse ? 1 : 0;
+			Target.bFactorMass = Source.bFactorMass ? 1 : 0;
+			Target.Impulse = QuantizeFixed(Source.Impulse);
+		}
+
+		FORCEINLINE void QuantizeImpulse(const FHitReactImpulse_Angular& Source, FQuantizedImpulse& Target)
+		{
+			QuantizeImpulse(static_cast<const FHitReactImpulse&>(Source), Target);
+			Target.EnumValue = static_cast<uint8>(Source.AngularUnits);
+		}
+
+		FORCEINLINE void QuantizeImpulse(const FHitReactImpulse_Radial& Source, FQuantizedImpulse& Target)
+		{
+			QuantizeImpulse(static_cast<const FHitReactImpulse&>(Source), Target);
+			Target.Radius = QuantizeFixed(Source.Radius);
+			Target.EnumValue = static_cast<uint8>(Source.Falloff);
+		}
+
+		FORCEINLINE void DequantizeImpulse(const FQuantizedImpulse& Source, FHitReactImpulse& Target)
+		{
+			Target.bApplyImpulse = Source.bApplyImpulse != 0;
+			Target.bFactorMass = Source.bFactorMass != 0;
+			Target.Impulse = DequantizeFixed(Source.Impulse);
+		}
+
+		FORCEINLINE void DequantizeImpulse(const FQuantizedImpulse& Source, FHitReactImpulse_Angular& Target)
+		{
+			DequantizeImpulse(Source, static_cast<FHitReactImpulse&>(Target));
+			Target.AngularUnits = static_cast<EHitReactUnits>(Source.EnumValue);
+		}
+
+		FORCEINLINE void DequantizeImpulse(const FQuantizedImpulse& Source, FHitReactImpulse_Radial& Target)
+		{
+			DequantizeImpulse(Source, static_cast<FHitReactImpulse&>(Target));
+			Target.Radius = DequantizeFixed(Source.Radius);
+			Target.Falloff = static_cast<EHitReactFalloff>(Source.EnumValue);
+		}
+
+		FORCEINLINE bool IsImpulseEqual(const FHitReactImpulse& A, const FHitReactImpulse& B)
+		{
+			return A.bApplyImpulse == B.bApplyImpulse && A.bFactorMass == B.bFactorMass && A.Impulse == B.Impulse;
+		}
+
+		FORCEINLINE bool IsImpulseEqual(const FHitReactImpulse_Angular& A, const FHitReactImpulse_Angular& B)
+		{
+			return IsImpulseEqual(static_cast<const FHitReactImpulse&>(A), static_cast<const FHitReactImpulse&>(B)) &&
+				A.AngularUnits == B.AngularUnits;
+		}
+
+		FORCEINLINE bool IsImpulseEqual(const FHitReactImpulse_Radial& A, const FHitReactImpulse_Radial& B)
+		{
+			return IsImpulseEqual(static_cast<const FHitReactImpulse&>(A), static_cast<const FHitReactImpulse&>(B)) &&
+				A.Radius == B.Radius && A.Falloff == B.Falloff;
+		}
+
+		/** Enums are bit-packed, make sure they fit */
+		FORCEINLINE bool IsEnumValid(uint8 Value)
+		{
+			constexpr uint8 MaxEnumValue = (1 << EnumBits) - 1;
+			return Value <= MaxEnumValue;
+		}
+
+		FORCEINLINE bool IsImpulseValid(const FHitReactImpulse& Source) { return true; }
+		FORCEINLINE bool IsImpulseValid(const FHitReactImpulse_Angular& Source) { return IsEnumValid(static_cast<uint8>(Source.AngularUnits)); }
+		FORCEINLINE bool IsImpulseValid(const FHitReactImpulse_Radial& Source) { return IsEnumValid(static_cast<uint8>(Source.Falloff)); }
+
+		/** Disabled impulses only send a single bit */
+		template<typename T>
+		void SerializeImpulse(FNetBitStreamWriter* Writer, const FQuantizedImpulse& Value)
+		{
+			Writer->WriteBool(Value.bApplyImpulse != 0);
+			if (Value.bApplyImpulse)
+			{
+				Writer->WriteBool(Value.bFactorMass != 0);
+				WritePackedInt32(Writer, Value.Impulse);
+				if constexpr (TImpulseLayout<T>::bHasRadius)
+				{
+					WritePackedInt32(Writer, Value.Radius);
+				}
+				if constexpr (TImpulseLayout<T>::bHasEnum)
+				{
+					Writer->WriteBits(Value.EnumValue, EnumBits);
+				}
+			}
+		}
+
+		template<typename T>
+		void DeserializeImpulse(FNetBitStreamReader* Reader, FQuantizedImpulse& Value)
+		{
+			Value = {};
+			Value.bApplyImpulse = Reader->ReadBool() ? 1 : 0;
+			if (Value.bApplyImpulse)
+			{
+				Value.bFactorMass = Reader->ReadBool() ? 1 : 0;
+				Value.Impulse = ReadPackedInt32(Reader);
+				if constexpr (TImpulseLayout<T>::bHasRadius)
+				{
+					Value.Radius = ReadPackedInt32(Reader);
+				}
+				if constexpr (TImpulseLayout<T>::bHasEnum)
+				{
+					Value.EnumValue = static_cast<uint8>(Reader->ReadBits(EnumBits));
+				}
+			}
+		}
+
+		/**
+		 * Quantizes and serializes an impulse struct, shared by the impulse and trigger serializers
+		 * Specialized for FHitReactImpulseParams, which combines all three impulses
+		 */
+		template<typename T>
+		struct TImpulseCodec
+		{
+			using QuantizedType = FQuantizedImpulse;
+
+			static void Serialize(FNetBitStreamWriter* Writer, const QuantizedType& Value) { SerializeImpulse<T>(Writer, Value); }
+			static void Deserialize(FNetBitStreamReader* Reader, QuantizedType& Value) { DeserializeImpulse<T>(Reader, Value); }
+			static void Quantize(const T& Source, QuantizedType& Target) { QuantizeImpulse(Source, Target); }
+			static void Dequantize(const QuantizedType& Source, T& Target) { DequantizeImpulse(Source, Target); }
+			static bool IsQuantizedEqual(const QuantizedType& A, const QuantizedType& B) { return A == B; }
+			static bool IsEqual(const T& A, const T& B) { return IsImpulseEqual(A, B); }
+			static bool Validate(const T& Source) { return IsImpulseValid(Source); }
+
+			/** Matches the legacy trigger NetSerialize, which only sends the trigger when the impulse is applied */
+			static bool IsApplying(const T& Source) { return Source.bApplyImpulse; }
+		};
+
+		template<>
+		struct TImpulseCodec<FHitReactImpulseParams>
+		{
+			struct QuantizedType
+			{
+				FQuantizedImpulse Linear;
+				FQuantizedImpulse Angular;
+				FQuantizedImpulse Radial;
+			};
+
+			static void Serialize(FNetBitStreamWriter* Writer, const QuantizedType& Value)
+			{
+				SerializeImpulse<FHitReactImpulse_Linear>(Writer, Value.Linear);
+				SerializeImpulse<FHitReactImpulse_Angular>(Writer, Value.Angular);
+				SerializeImpulse<FHitReactImpulse_Radial>(Writer, Value.Radial);
+			}
+
+			static void Deserialize(FNetBitStreamReader* Reader, QuantizedType& Value)
+			{
+				DeserializeImpulse<FHitReactImpulse_Linear>(Reader, Value.Linear);
+				DeserializeImpulse<FHitReactImpulse_Angular>(Reader, Value.Angular);
+				DeserializeImpulse<FHitReactImpulse_Radial>(Reader, Value.Radial);
+			}
+
+			static void Quantize(const FHitReactImpulseParams& Source, QuantizedType& Target)
+			{
+				QuantizeImpulse(Source.LinearImpulse, Target.Linear);
+				QuantizeImpulse(Source.AngularImpulse, Target.Angular);
+				QuantizeImpulse(Source.RadialImpulse, Target.Radial);
+			}
+
+			static void Dequantize(const QuantizedType& Source, FHitReactImpulseParams& Target)
+			{
+				DequantizeImpulse(Source.Linear, Target.LinearImpulse);
+				DequantizeImpulse(Source.Angular, Target.AngularImpulse);
+				DequantizeImpulse(Source.Radial, Target.RadialImpulse);
+			}
+
+			static bool IsQuantizedEqual(const QuantizedType& A, const QuantizedType& B)
+			{
+				return A.Linear == B.Linear && A.Angular == B.Angular && A.Radial == B.Radial;
+			}
+
+			static bool IsEqual(const FHitReactImpulseParams& A, const FHitReactImpulseParams& B)
+			{
+				return IsImpulseEqual(A.LinearImpulse, B.LinearImpulse) && IsImpulseEqual(A.AngularImpulse, B.AngularImpulse) &&
+					IsImpulseEqual(A.RadialImpulse, B.RadialImpulse);
+			}
+
+			static bool Validate(const FHitReactImpulseParams& Source)
+			{
+				return IsImpulseValid(Source.AngularImpulse) && IsImpulseValid(Source.RadialImpulse);
+			}
+
+			static bool IsApplying(const FHitReactImpulseParams& Source)
+			{
+				return Source.LinearImpulse.bApplyImpulse || Source.AngularImpulse.bApplyImpulse || Source.RadialImpulse.bApplyImpulse;
+			}
+		};
+	}
+
+	/**
+	 * Impulse structs
+	 * Impulse strengths and radii are fixed point, enums are bit-packed, and disabled impulses only send a single bit
+	 */
+	template<typename T, typename ConfigT>
+	struct THitReactImpulseNetSerializer
+	{
+		static constexpr uint32 Version = 0;
+
+		using FImpulseCodec = HitReactIris::TImpulseCodec<T>;
+
+		using SourceType = T;
+		using QuantizedType = typename FImpulseCodec::QuantizedType;
+		using ConfigType = ConfigT;
+
+		inline static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+		{
+			FImpulseCodec::Serialize(Context.GetBitStreamWriter(), *reinterpret_cast<const QuantizedType*>(Args.Source));
+		}
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+		{
+			FImpulseCodec::Deserialize(Context.GetBitStreamReader(), *reinterpret_cast<QuantizedType*>(Args.Target));
+		}
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+		{
+			FImpulseCodec::Quantize(*reinterpret_cast<const SourceType*>(Args.Source), *reinterpret_cast<QuantizedType*>(Args.Target));
+		}
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+		{
+			FImpulseCodec::Dequantize(*reinterpret_cast<const QuantizedType*>(Args.Source), *reinterpret_cast<SourceType*>(Args.Target));
+		}
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+		{
+			if (Args.bStateIsQuantized)
+			{
+				return FImpulseCodec::IsQuantizedEqual(*reinterpret_cast<const QuantizedType*>(Args.Source0),
+					*reinterpret_cast<const QuantizedType*>(Args.Source1));
+			}
+			return FImpulseCodec::IsEqual(*reinterpret_cast<const SourceType*>(Args.Source0), *reinterpret_cast<const SourceType*>(Args.Source1));
+		}
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+		{
+			return FImpulseCodec::Validate(*reinterpret_cast<const SourceType*>(Args.Source));
+		}
+	};
+
+	struct FHitReactImpulseNetSerializer : THitReactImpulseNetSerializer<FHitReactImpulse, FHitReactImpulseNetSerializerConfig> {};
+	struct FHitReactImpulseLinearNetSerializer : THitReactImpulseNetSerializer<FHitReactImpulse_Linear, FHitReactImpulseNetSerializerConfig> {};
+	struct FHitReactImpulseAngularNetSerializer : THitReactImpulseNetSerializer<FHitReactImpulse_Angular, FHitReactImpulseNetSerializerConfig> {};
+	struct FHitReactImpulseRadialNetSerializer : THitReactImpulseNetSerializer<FHitReactImpulse_Radial, FHitReactImpulseNetSerializerConfig> {};
+	struct FHitReactImpulseParamsNetSerializer : THitReactImpulseNetSerializer<FHitReactImpulseParams, FHitReactImpulseParamsNetSerializerConfig> {};
+
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseLinearNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseAngularNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseRadialNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseParamsNetSerializer, );
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseLinearNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseAngularNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseRadialNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseParamsNetSerializer);
+
+	/**
+	 * FHitReactImpulse_WorldParams
+	 * Mirrors the legacy NetSerialize, including the packed representation from MakeNetPacked
+	 * Unpacked vectors are full precision, packed directions are octahedral and packed radial locations are fixed point
+	 */
+	struct FHitReactImpulseWorldParamsNetSerializer
+	{
+		static constexpr uint32 Version = 1;
+
+		struct FQuantizedType
+		{
+			uint64 LinearDirection[3];  // Double bits, or octahedral in [0] when packed
+			uint64 AngularDirection[3];
+			uint64 RadialLocation[3];  // Double bits, or fixed point when packed
+			uint8 bNetPacked;
+			uint8 bNetRadialRelative;
+			uint8 NetFieldMask;
+		};
+
+		using SourceType = FHitReactImpulse_WorldParams;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FHitReactImpulseWorldParamsNetSerializerConfig;
+
+		inline static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+	};
+	UE_NET_DECLARE_SERIALIZER(FHitReactImpulseWorldParamsNetSerializer, );
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactImpulseWorldParamsNetSerializer);
+
+	void FHitReactImpulseWorldParamsNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+	{
+		const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+		if (Writer->WriteBool(Value.bNetPacked != 0))
+		{
+			Writer->WriteBits(Value.NetFieldMask, 3);
+			if (Value.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Linear)
+			{
+				Writer->WriteBits(static_cast<uint32>(Value.LinearDirection[0]), 32);
+			}
+			if (Value.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Angular)
+			{
+				Writer->WriteBits(static_cast<uint32>(Value.AngularDirection[0]), 32);
+			}
+			if (Value.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Radial)
+			{
+				Writer->WriteBool(Value.bNetRadialRelative != 0);
+				for (const uint64 Component : Value.RadialLocation)
+				{
+					WritePackedInt32(Writer, static_cast<int32>(static_cast<uint32>(Component)));
+				}
+			}
+			return;
+		}
+
+		for (const uint64 Component : Value.LinearDirection)
+		{
+			HitReactIris::WriteUint64(Writer, Component);
+		}
+		for (const uint64 Component : Value.AngularDirection)
+		{
+			HitReactIris::WriteUint64(Writer, Component);
+		}
+		for (const uint64 Component : Value.RadialLocation)
+		{
+			HitReactIris::WriteUint64(Writer, Component);
+		}
+	}
+
+	void FHitReactImpulseWorldParamsNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+	{
+		QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+		Target = {};
+		Target.bNetPacked = Reader->ReadBool() ? 1 : 0;
+		if (Target.bNetPacked)
+		{
+			Target.NetFieldMask = static_cast<uint8>(Reader->ReadBits(3));
+			if (Target.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Linear)
+			{
+				Target.LinearDirection[0] = Reader->ReadBits(32);
+			}
+			if (Target.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Angular)
+			{
+				Target.AngularDirection[0] = Reader->ReadBits(32);
+			}
+			if (Target.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Radial)
+			{
+				Target.bNetRadialRelative = Reader->ReadBool() ? 1 : 0;
+				for (uint64& Component : Target.RadialLocation)
+				{
+					Component = static_cast<uint32>(ReadPackedInt32(Reader));
+				}
+			}
+			return;
+		}
+
+		for (uint64& Component : Target.LinearDirection)
+		{
+			Component = HitReactIris::ReadUint64(Reader);
+		}
+		for (uint64& Component : Target.AngularDirection)
+		{
+			Component = HitReactIris::ReadUint64(Reader);
+		}
+		for (uint64& Component : Target.RadialLocation)
+		{
+			Component = HitReactIris::ReadUint64(Reader);
+		}
+	}
+
+	void FHitReactImpulseWorldParamsNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+	{
+		const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+		QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+		Target = {};
+		Target.bNetPacked = Source.bNetPacked ? 1 : 0;
+
+		if (!Source.bNetPacked)
+		{
+			HitReactIris::QuantizeVector(Source.LinearDirection, Target.LinearDirection);
+			HitReactIris::QuantizeVector(Source.AngularDirection, Target.AngularDirection);
+			HitReactIris::QuantizeVector(Source.RadialLocation, Target.RadialLocation);
+			return;
+		}
+
+		Target.NetFieldMask = Source.NetFieldMask;
+		if (Source.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Linear)
+		{
+			Target.LinearDirection[0] = HitReactIris::QuantizeOctahedral(Source.LinearDirection);
+		}
+		if (Source.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Angular)
+		{
+			Target.AngularDirection[0] = HitReactIris::QuantizeOctahedral(Source.AngularDirection);
+		}
+		if (Source.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Radial)
+		{
+			Target.bNetRadialRelative = Source.bNetRadialRelative ? 1 : 0;
+			for (int32 Axis = 0; Axis < 3; Axis++)
+			{
+				Target.RadialLocation[Axis] = static_cast<uint32>(HitReactIris::QuantizeFixed(Source.RadialLocation[Axis]));
+			}
+		}
+	}
+
+	void FHitReactImpulseWorldParamsNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+	{
+		const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+		Target.bNetPacked = Source.bNetPacked != 0;
+		Target.bNetRadialRelative = Source.bNetRadialRelative != 0;
+		Target.NetFieldMask = Source.NetFieldMask;
+
+		if (!Source.bNetPacked)
+		{
+			Target.LinearDirection = HitReactIris::DequantizeVector(Source.LinearDirection);
+			Target.AngularDirection = HitReactIris::DequantizeVector(Source.AngularDirection);
+			Target.RadialLocation = HitReactIris::DequantizeVector(Source.RadialLocation);
+			return;
+		}
+
+		Target.LinearDirection = (Source.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Linear) ?
+			HitReactIris::DequantizeOctahedral(static_cast<uint32>(Source.LinearDirection[0])) : FVector::ZeroVector;
+		Target.AngularDirection = (Source.NetFieldMask & FHitReactImpulse_WorldParams::NetField_Angular) ?
+			HitReactIris::DequantizeOctahedral(static_cast<uint32>(Source.AngularDirection[0])) : FVector::ZeroVector;
+		Target.RadialLocation = FVector(
+			HitReactIris::DequantizeFixed(static_cast<int32>(static_cast<uint32>(Source.RadialLocation[0]))),
+			HitReactIris::DequantizeFixed(static_cast<int32>(static_cast<uint32>(Source.RadialLocation[1]))),
+			HitReactIris::DequantizeFixed(static_cast<int32>(static_cast<uint32>(Source.RadialLocation[2]))));
+	}
+
+	bool FHitReactImpulseWorldParamsNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+	{
+		if (Args.bStateIsQuantized)
+		{
+			const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+			const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+			return FMemory::Memcmp(Value0.LinearDirection, Value1.LinearDirection, sizeof(Value0.LinearDirection)) == 0 &&
+				FMemory::Memcmp(Value0.AngularDirection, Value1.AngularDirection, sizeof(Value0.AngularDirection)) == 0 &&
+				FMemory::Memcmp(Value0.RadialLocation, Value1.RadialLocation, sizeof(Value0.RadialLocation)) == 0 &&
+				Value0.bNetPacked == Value1.bNetPacked && Value0.bNetRadialRelative == Value1.bNetRadialRelative &&
+				Value0.NetFieldMask == Value1.NetFieldMask;
+		}
+
+		const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+		const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+		return Value0.LinearDirection == Value1.LinearDirection && Value0.AngularDirection == Value1.AngularDirection &&
+			Value0.RadialLocation == Value1.RadialLocation && Value0.bNetPacked == Value1.bNetPacked &&
+			Value0.bNetRadialRelative == Value1.bNetRadialRelative && Value0.NetFieldMask == Value1.NetFieldMask;
+	}
+
+	bool FHitReactImpulseWorldParamsNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+	{
+		const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+		return Source.NetFieldMask <= 0x7;
+	}
+
+	/**
+	 * FHitReactInputParams
+	 * Mirrors the legacy NetSerialize, compact net params from UHitReact::MakeCompactNetParams are sent as indices with the
+	 * bone indices bit-packed to the skeleton, otherwise the profile and bone data are sent as paths and the bones as names
+	 */
+	struct FHitReactInputParamsNetSerializer
+	{
+		static constexpr uint32 Version = 0;
+		static constexpr bool bHasDynamicState = true;
+		static constexpr bool bHasCustomNetReference = true;
+
+		/** How an asset reference is serialized, matches the legacy NetSerialize */
+		enum EAssetMode : uint8
+		{
+			AssetMode_None,
+			AssetMode_Index,
+			AssetMode_Path,
+		};
+
+		/** Paths and names are quantized by the engine serializers into inline storage */
+		struct FQuantizedType
+		{
+			alignas(HitReactIris::NestedStorageAlignment) uint8 Profile[HitReactIris::PathStorageSize];
+			alignas(HitReactIris::NestedStorageAlignment) uint8 BoneData[HitReactIris::PathStorageSize];
+			alignas(HitReactIris::NestedStorageAlignment) uint8 SimulatedBoneName[HitReactIris::NameStorageSize];
+			alignas(HitReactIris::NestedStorageAlignment) uint8 ImpulseBoneName[HitReactIris::NameStorageSize];
+			int16 NetProfileIndex;
+			int16 NetBoneDataIndex;
+			int16 NetSimulatedBoneIndex;
+			int16 NetImpulseBoneIndex;
+			uint16 NetNumBones;
+			uint8 ProfileMode;
+			uint8 BoneDataMode;
+			uint8 bCompactBones;
+			uint8 bIncludeSelf;
+		};
+
+		using SourceType = FHitReactInputParams;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FHitReactInputParamsNetSerializerConfig;
+
+		inline static const ConfigType DefaultConfig;
+
+		/** Triggers don't send the bone data or impulse bone, matching their legacy NetSerialize */
+		inline static const ConfigType TriggerConfig = []
+		{
+			ConfigType Config;
+			Config.bIncludeBoneData = false;
+			Config.bIncludeImpulseBone = false;
+			return Config;
+		}();
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args);
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args);
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args);
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args);
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args);
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args);
+
+		static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args);
+		static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args);
+
+		static void CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args);
+
+		/** Make sure the engine serializers fit the inline storage, once they are all registered */
+		static void CheckNestedStorage();
+
+	private:
+		static const FNetSerializer& GetPathSerializer() { return UE_NET_GET_SERIALIZER(FSoftObjectPathNetSerializer); }
+		static const FNetSerializer& GetNameSerializer() { return UE_NET_GET_SERIALIZER(FNameNetSerializer); }
+
+		template<typename T>
+		static uint8 GetAssetMode(int16 Index, const TSoftObjectPtr<T>& Asset)
+		{
+			return Index != INDEX_NONE ? AssetMode_Index : Asset.IsNull() ? AssetMode_None : AssetMode_Path;
+		}
+
+		template<typename T>
+		static void QuantizeAsset(FNetSerializationContext& Context, const FNetQuantizeArgs& Args, const TSoftObjectPtr<T>& Asset, uint8* Target)
+		{
+			// The nested state is left in place when unused, it may own allocations that are freed with the rest of the state
+			const FSoftObjectPath Path = Asset.ToSoftObjectPath();
+			FNetQuantizeArgs PathArgs = HitReactIris::MakeNestedArgs(Args, GetPathSerializer().DefaultConfig);
+			PathArgs.Source = NetSerializerValuePointer(&Path);
+			PathArgs.Target = NetSerializerValuePointer(Target);
+			GetPathSerializer().Quantize(Context, PathArgs);
+		}
+
+		template<typename T>
+		static void DequantizeAsset(FNetSerializationContext& Context, const FNetDequantizeArgs& Args, uint8 Mode, const uint8* Source,
+			TSoftObjectPtr<T>& Target)
+		{
+			if (Mode != AssetMode_Path)
+			{
+				Target.Reset();
+				return;
+			}
+
+			FSoftObjectPath Path;
+			FNetDequantizeArgs PathArgs = HitReactIris::MakeNestedArgs(Args, GetPathSerializer().DefaultConfig);
+			PathArgs.Source = NetSerializerValuePointer(Source);
+			PathArgs.Target = NetSerializerValuePointer(&Path);
+			GetPathSerializer().Dequantize(Context, PathArgs);
+			Target = TSoftObjectPtr<T>(Path);
+		}
+
+		static void QuantizeName(FNetSerializationContext& Context, const FNetQuantizeArgs& Args, const FName& Name, uint8* Target);
+		static void DequantizeName(FNetSerializationContext& Context, const FNetDequantizeArgs& Args, const uint8* Source, FName& Target);
+
+		static void SerializeAsset(FNetSerializationContext& Context, const FNetSerializeArgs& Args, uint8 Mode, int16 Index, const uint8* Source);
+		static void DeserializeAsset(FNetSerializationContext& Context, const FNetDeserializeArgs& Args, uint8& Mode, int16& Index, uint8* Target);
+
+		static void SerializeNested(FNetSerializationContext& Context, const FNetSerializeArgs& Args, const FNetSerializer& Serializer, const uint8* Source);
+		static void DeserializeNested(FNetSerializationContext& Context, const FNetDeserializeArgs& Args, const FNetSerializer& Serializer, uint8* Target);
+		static bool IsNestedEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args, const FNetSerializer& Serializer,
+			const uint8* Source0, const uint8* Source1);
+	};
+	UE_NET_DECLARE_SERIALIZER(FHitReactInputParamsNetSerializer, );
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactInputParamsNetSerializer);
+
+	void FHitReactInputParamsNetSerializer::QuantizeName(FNetSerializationContext& Context, const FNetQuantizeArgs& Args, const FName& Name,
+		uint8* Target)
+	{
+		FNetQuantizeArgs NameArgs = HitReactIris::MakeNestedArgs(Args, GetNameSerializer().DefaultConfig);
+		NameArgs.Source = NetSerializerValuePointer(&Name);
+		NameArgs.Target = NetSerializerValuePointer(Target);
+		GetNameSerializer().Quantize(Context, NameArgs);
+	}
+
+	void FHitReactInputParamsNetSerializer::DequantizeName(FNetSerializationContext& Context, const FNetDequantizeArgs& Args,
+		const uint8* Source, FName& Target)
+	{
+		FNetDequantizeArgs NameArgs = HitReactIris::MakeNestedArgs(Args, GetNameSerializer().DefaultConfig);
+		NameArgs.Source = NetSerializerValuePointer(Source);
+		NameArgs.Target = NetSerializerValuePointer(&Target);
+		GetNameSerializer().Dequantize(Context, NameArgs);
+	}
+
+	void FHitReactInputParamsNetSerializer::SerializeNested(FNetSerializationContext& Context, const FNetSerializeArgs& Args,
+		const FNetSerializer& Serializer, const uint8* Source)
+	{
+		FNetSerializeArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, Serializer.DefaultConfig);
+		NestedArgs.Source = NetSerializerValuePointer(Source);
+		Serializer.Serialize(Context, NestedArgs);
+	}
+
+	void FHitReactInputParamsNetSerializer::DeserializeNested(FNetSerializationContext& Context, const FNetDeserializeArgs& Args,
+		const FNetSerializer& Serializer, uint8* Target)
+	{
+		FNetDeserializeArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, Serializer.DefaultConfig);
+		NestedArgs.Target = NetSerializerValuePointer(Target);
+		Serializer.Deserialize(Context, NestedArgs);
+	}
+
+	bool FHitReactInputParamsNetSerializer::IsNestedEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args,
+		const FNetSerializer& Serializer, const uint8* Source0, const uint8* Source1)
+	{
+		FNetIsEqualArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, Serializer.DefaultConfig);
+		NestedArgs.Source0 = NetSerializerValuePointer(Source0);
+		NestedArgs.Source1 = NetSerializerValuePointer(Source1);
+		return Serializer.IsEqual(Context, NestedArgs);
+	}
+
+	void FHitReactInputParamsNetSerializer::SerializeAsset(FNetSerializationContext& Context, const FNetSerializeArgs& Args, uint8 Mode,
+		int16 Index, const uint8* Source)
+	{
+		FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+		Writer->WriteBits(Mode, 2);
+		if (Mode == AssetMode_Index)
+		{
+			WritePackedUint32(Writer, static_cast<uint32>(Index));
+		}
+		else if (Mode == AssetMode_Path)
+		{
+			SerializeNested(Context, Args, GetPathSerializer(), Source);
+		}
+	}
+
+	void FHitReactInputParamsNetSerializer::DeserializeAsset(FNetSerializationContext& Context, const FNetDeserializeArgs& Args,
+		uint8& Mode, int16& Index, uint8* Target)
+	{
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+		Mode = static_cast<uint8>(Reader->ReadBits(2));
+		Index = INDEX_NONE;
+		if (Mode == AssetMode_Index)
+		{
+			Index = static_cast<int16>(FMath::Min<uint32>(ReadPackedUint32(Reader), MAX_int16));
+		}
+		else if (Mode == AssetMode_Path)
+		{
+			DeserializeNested(Context, Args, GetPathSerializer(), Target);
+		}
+		else
+		{
+			Mode = AssetMode_None;
+		}
+	}
+
+	void FHitReactInputParamsNetSerializer::Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+	{
+		const ConfigType& Config = *static_cast<const ConfigType*>(Args.NetSerializerConfig);
+		const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		FNetBitStreamWriter* Writer = Context.GetBitStreamWriter();
+
+		SerializeAsset(Context, Args, Value.ProfileMode, Value.NetProfileIndex, Value.Profile);
+		if (Config.bIncludeBoneData)
+		{
+			SerializeAsset(Context, Args, Value.BoneDataMode, Value.NetBoneDataIndex, Value.BoneData);
+		}
+
+		// Bone indices are only sent when every bone we need could be converted, otherwise fall back to names
+		if (Writer->WriteBool(Value.bCompactBones != 0))
+		{
+			WritePackedUint32(Writer, Value.NetNumBones);
+			const uint32 BoneIndexBits = HitReactIris::GetBoneIndexBits(Value.NetNumBones);
+			if (BoneIndexBits > 0)
+			{
+				Writer->WriteBits(static_cast<uint32>(Value.NetSimulatedBoneIndex), BoneIndexBits);
+			}
+			if (Config.bIncludeImpulseBone && Writer->WriteBool(Value.NetImpulseBoneIndex != INDEX_NONE) && BoneIndexBits > 0)
+			{
+				Writer->WriteBits(static_cast<uint32>(Value.NetImpulseBoneIndex), BoneIndexBits);
+			}
+		}
+		else
+		{
+			SerializeNested(Context, Args, GetNameSerializer(), Value.SimulatedBoneName);
+			if (Config.bIncludeImpulseBone)
+			{
+				SerializeNested(Context, Args, GetNameSerializer(), Value.ImpulseBoneName);
+			}
+		}
+
+		Writer->WriteBool(Value.bIncludeSelf != 0);
+	}
+
+	void FHitReactInputParamsNetSerializer::Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+	{
+		const ConfigType& Config = *static_cast<const ConfigType*>(Args.NetSerializerConfig);
+		QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+		FNetBitStreamReader* Reader = Context.GetBitStreamReader();
+
+		DeserializeAsset(Context, Args, Target.ProfileMode, Target.NetProfileIndex, Target.Profile);
+		Target.BoneDataMode = AssetMode_None;
+		Target.NetBoneDataIndex = INDEX_NONE;
+		if (Config.bIncludeBoneData)
+		{
+			DeserializeAsset(Context, Args, Target.BoneDataMode, Target.NetBoneDataIndex, Target.BoneData);
+		}
+
+		Target.NetNumBones = 0;
+		Target.NetSimulatedBoneIndex = INDEX_NONE;
+		Target.NetImpulseBoneIndex = INDEX_NONE;
+		Target.bCompactBones = Reader->ReadBool() ? 1 : 0;
+		if (Target.bCompactBones)
+		{
+			Target.NetNumBones = static_cast<uint16>(FMath::Clamp<uint32>(ReadPackedUint32(Reader), 1, MAX_uint16));
+			const uint32 BoneIndexBits = HitReactIris::GetBoneIndexBits(Target.NetNumBones);
+			const uint32 SimulatedBoneIndex = BoneIndexBits > 0 ? Reader->ReadBits(BoneIndexBits) : 0;
+			Target.NetSimulatedBoneIndex = static_cast<int16>(FMath::Min<uint32>(SimulatedBoneIndex, MAX_int16));
+			if (Config.bIncludeImpulseBone && Reader->ReadBool())
+			{
+				const uint32 ImpulseBoneIndex = BoneIndexBits > 0 ? Reader->ReadBits(BoneIndexBits) : 0;
+				Target.NetImpulseBoneIndex = static_cast<int16>(FMath::Min<uint32>(ImpulseBoneIndex, MAX_int16));
+			}
+		}
+		else
+		{
+			DeserializeNested(Context, Args, GetNameSerializer(), Target.SimulatedBoneName);
+			if (Config.bIncludeImpulseBone)
+			{
+				DeserializeNested(Context, Args, GetNameSerializer(), Target.ImpulseBoneName);
+			}
+		}
+
+		Target.bIncludeSelf = Reader->ReadBool() ? 1 : 0;
+	}
+
+	void FHitReactInputParamsNetSerializer::Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+	{
+		const ConfigType& Config = *static_cast<const ConfigType*>(Args.NetSerializerConfig);
+		const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+		QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+		Target.ProfileMode = GetAssetMode(Source.NetProfileIndex, Source.Profile);
+		Target.NetProfileIndex = Source.NetProfileIndex;
+		if (Target.ProfileMode == AssetMode_Path)
+		{
+			QuantizeAsset(Context, Args, Source.Profile, Target.Profile);
+		}
+
+		Target.BoneDataMode = AssetMode_None;
+		Target.NetBoneDataIndex = INDEX_NONE;
+		if (Config.bIncludeBoneData)
+		{
+			Target.BoneDataMode = GetAssetMode(Source.NetBoneDataIndex, Source.BoneData);
+			Target.NetBoneDataIndex = Source.NetBoneDataIndex;
+			if (Target.BoneDataMode == AssetMode_Path)
+			{
+				QuantizeAsset(Context, Args, Source.BoneData, Target.BoneData);
+			}
+		}
+
+		Target.bCompactBones = Source.NetSimulatedBoneIndex != INDEX_NONE && Source.NetNumBones > 0 ? 1 : 0;
+		if (Target.bCompactBones)
+		{
+			Target.NetNumBones = Source.NetNumBones;
+			Target.NetSimulatedBoneIndex = Source.NetSimulatedBoneIndex;
+			Target.NetImpulseBoneIndex = Config.bIncludeImpulseBone ? Source.NetImpulseBoneIndex : INDEX_NONE;
+		}
+		else
+		{
+			Target.NetNumBones = 0;
+			Target.NetSimulatedBoneIndex = INDEX_NONE;
+			Target.NetImpulseBoneIndex = INDEX_NONE;
+			QuantizeName(Context, Args, Source.SimulatedBoneName, Target.SimulatedBoneName);
+			if (Config.bIncludeImpulseBone)
+			{
+				QuantizeName(Context, Args, Source.ImpulseBoneName, Target.ImpulseBoneName);
+			}
+		}
+
+		Target.bIncludeSelf = Source.bIncludeSelf ? 1 : 0;
+	}
+
+	void FHitReactInputParamsNetSerializer::Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+	{
+		const ConfigType& Config = *static_cast<const ConfigType*>(Args.NetSerializerConfig);
+		const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+		Target.NetProfileIndex = Source.ProfileMode == AssetMode_Index ? Source.NetProfileIndex : INDEX_NONE;
+		DequantizeAsset(Context, Args, Source.ProfileMode, Source.Profile, Target.Profile);
+		if (Config.bIncludeBoneData)
+		{
+			Target.NetBoneDataIndex = Source.BoneDataMode == AssetMode_Index ? Source.NetBoneDataIndex : INDEX_NONE;
+			DequantizeAsset(Context, Args, Source.BoneDataMode, Source.BoneData, Target.BoneData);
+		}
+
+		if (Source.bCompactBones)
+		{
+			Target.NetNumBones = Source.NetNumBones;
+			Target.NetSimulatedBoneIndex = Source.NetSimulatedBoneIndex;
+			Target.NetImpulseBoneIndex = Source.NetImpulseBoneIndex;
+			Target.SimulatedBoneName = NAME_None;
+			Target.ImpulseBoneName = NAME_None;
+		}
+		else
+		{
+			Target.NetNumBones = 0;
+			Target.NetSimulatedBoneIndex = INDEX_NONE;
+			Target.NetImpulseBoneIndex = INDEX_NONE;
+			DequantizeName(Context, Args, Source.SimulatedBoneName, Target.SimulatedBoneName);
+			if (Config.bIncludeImpulseBone)
+			{
+				DequantizeName(Context, Args, Source.ImpulseBoneName, Target.ImpulseBoneName);
+			}
+		}
+
+		Target.bIncludeSelf = Source.bIncludeSelf != 0;
+	}
+
+	bool FHitReactInputParamsNetSerializer::IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+	{
+		const ConfigType& Config = *static_cast<const ConfigType*>(Args.NetSerializerConfig);
+
+		if (Args.bStateIsQuantized)
+		{
+			const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+			const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+
+			// Unused indices are always INDEX_NONE, but unused nested state may be stale so is only compared when used
+			if (Value0.ProfileMode != Value1.ProfileMode || Value0.NetProfileIndex != Value1.NetProfileIndex ||
+				Value0.BoneDataMode != Value1.BoneDataMode || Value0.NetBoneDataIndex != Value1.NetBoneDataIndex ||
+				Value0.bCompactBones != Value1.bCompactBones || Value0.NetNumBones != Value1.NetNumBones ||
+				Value0.NetSimulatedBoneIndex != Value1.NetSimulatedBoneIndex || Value0.NetImpulseBoneIndex != Value1.NetImpulseBoneIndex ||
+				Value0.bIncludeSelf != Value1.bIncludeSelf)
+			{
+				return false;
+			}
+
+			if (Value0.ProfileMode == AssetMode_Path && !IsNestedEqual(Context, Args, GetPathSerializer(), Value0.Profile, Value1.Profile))
+			{
+				return false;
+			}
+
+			if (Value0.BoneDataMode == AssetMode_Path && !IsNestedEqual(Context, Args, GetPathSerializer(), Value0.BoneData, Value1.BoneData))
+			{
+				return false;
+			}
+
+			if (!Value0.bCompactBones)
+			{
+				if (!IsNestedEqual(Context, Args, GetNameSerializer(), Value0.SimulatedBoneName, Value1.SimulatedBoneName))
+				{
+					return false;
+				}
+				if (Config.bIncludeImpulseBone &&
+					!IsNestedEqual(Context, Args, GetNameSerializer(), Value0.ImpulseBoneName, Value1.ImpulseBoneName))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+		const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+		return Value0.Profile == Value1.Profile && Value0.NetProfileIndex == Value1.NetProfileIndex &&
+			(!Config.bIncludeBoneData || (Value0.BoneData == Value1.BoneData && Value0.NetBoneDataIndex == Value1.NetBoneDataIndex)) &&
+			Value0.SimulatedBoneName == Value1.SimulatedBoneName && Value0.NetSimulatedBoneIndex == Value1.NetSimulatedBoneIndex &&
+			(!Config.bIncludeImpulseBone || (Value0.ImpulseBoneName == Value1.ImpulseBoneName && Value0.NetImpulseBoneIndex == Value1.NetImpulseBoneIndex)) &&
+			Value0.NetNumBones == Value1.NetNumBones && Value0.bIncludeSelf == Value1.bIncludeSelf;
+	}
+
+	bool FHitReactInputParamsNetSerializer::Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+	{
+		const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+
+		// Bone indices are bit-packed to the number of bones, make sure they fit
+		if (Source.NetSimulatedBoneIndex != INDEX_NONE && Source.NetNumBones > 0)
+		{
+			return Source.NetSimulatedBoneIndex >= 0 && Source.NetSimulatedBoneIndex < Source.NetNumBones &&
+				Source.NetImpulseBoneIndex < Source.NetNumBones;
+		}
+		return true;
+	}
+
+	void FHitReactInputParamsNetSerializer::CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+	{
+		const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+		// Stale nested state is cloned and freed too, so we never need to track what was last used
+		auto CloneNested = [&Context, &Args](const FNetSerializer& Serializer, const uint8* NestedSource, uint8* NestedTarget)
+		{
+			if (Serializer.CloneDynamicState)
+			{
+				FNetCloneDynamicStateArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, Serializer.DefaultConfig);
+				NestedArgs.Source = NetSerializerValuePointer(NestedSource);
+				NestedArgs.Target = NetSerializerValuePointer(NestedTarget);
+				Serializer.CloneDynamicState(Context, NestedArgs);
+			}
+		};
+
+		CloneNested(GetPathSerializer(), Source.Profile, Target.Profile);
+		CloneNested(GetPathSerializer(), Source.BoneData, Target.BoneData);
+		CloneNested(GetNameSerializer(), Source.SimulatedBoneName, Target.SimulatedBoneName);
+		CloneNested(GetNameSerializer(), Source.ImpulseBoneName, Target.ImpulseBoneName);
+	}
+
+	void FHitReactInputParamsNetSerializer::FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+	{
+		QuantizedType& Source = *reinterpret_cast<QuantizedType*>(Args.Source);
+
+		auto FreeNested = [&Context, &Args](const FNetSerializer& Serializer, uint8* NestedSource)
+		{
+			if (Serializer.FreeDynamicState)
+			{
+				FNetFreeDynamicStateArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, Serializer.DefaultConfig);
+				NestedArgs.Source = NetSerializerValuePointer(NestedSource);
+				Serializer.FreeDynamicState(Context, NestedArgs);
+			}
+		};
+
+		FreeNested(GetPathSerializer(), Source.Profile);
+		FreeNested(GetPathSerializer(), Source.BoneData);
+		FreeNested(GetNameSerializer(), Source.SimulatedBoneName);
+		FreeNested(GetNameSerializer(), Source.ImpulseBoneName);
+	}
+
+	void FHitReactInputParamsNetSerializer::CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args)
+	{
+		const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+		const FNetSerializer& PathSerializer = GetPathSerializer();
+		if (!PathSerializer.CollectNetReferences)
+		{
+			return;
+		}
+
+		auto CollectNested = [&Context, &Args, &PathSerializer](const uint8* NestedSource)
+		{
+			FNetCollectReferencesArgs NestedArgs = HitReactIris::MakeNestedArgs(Args, PathSerializer.DefaultConfig);
+			NestedArgs.Source = NetSerializerValuePointer(NestedSource);
+			PathSerializer.CollectNetReferences(Context, NestedArgs);
+		};
+
+		if (Source.ProfileMode == AssetMode_Path)
+		{
+			CollectNested(Source.Profile);
+		}
+		if (Source.BoneDataMode == AssetMode_Path)
+		{
+			CollectNested(Source.BoneData);
+		}
+	}
+
+	void FHitReactInputParamsNetSerializer::CheckNestedStorage()
+	{
+		auto CheckStorage = [](const FNetSerializer& Serializer, SIZE_T StorageSize)
+		{
+			checkf(Serializer.QuantizedTypeSize <= StorageSize && Serializer.QuantizedTypeAlignment <= HitReactIris::NestedStorageAlignment,
+				TEXT("%s quantized state (%u bytes, %u alignment) doesn't fit FHitReactInputParamsNetSerializer's inline storage"),
+				Serializer.Name, Serializer.QuantizedTypeSize, Serializer.QuantizedTypeAlignment);
+		};
+
+		CheckStorage(GetPathSerializer(), HitReactIris::PathStorageSize);
+		CheckStorage(GetNameSerializer(), HitReactIris::NameStorageSize);
+	}
+
+	/**
+	 * Trigger structs
+	 * Mirrors the legacy NetSerialize, nothing is sent unless the impulse is applied
+	 * The input params are nested without the bone data or impulse bone, so compact net params apply under Iris too
+	 */
+	template<typename TriggerType, typename ImpulseType, ImpulseType TriggerType::*ImpulseMember>
+	struct THitReactTriggerNetSerializer
+	{
+		static constexpr uint32 Version = 0;
+		static constexpr bool bHasDynamicState = true;
+		static constexpr bool bHasCustomNetReference = true;
+
+		using FImpulseCodec = HitReactIris::TImpulseCodec<ImpulseType>;
+		using FParamsSerializer = FHitReactInputParamsNetSerializer;
+
+		struct FQuantizedType
+		{
+			FParamsSerializer::QuantizedType Params;
+			typename FImpulseCodec::QuantizedType Impulse;
+			uint8 bApplying;
+		};
+
+		using SourceType = TriggerType;
+		using QuantizedType = FQuantizedType;
+		using ConfigType = FHitReactTriggerNetSerializerConfig;
+
+		inline static const ConfigType DefaultConfig;
+
+		static void Serialize(FNetSerializationContext& Context, const FNetSerializeArgs& Args)
+		{
+			const QuantizedType& Value = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			if (Context.GetBitStreamWriter()->WriteBool(Value.bApplying != 0))
+			{
+				FNetSerializeArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+				ParamsArgs.Source = NetSerializerValuePointer(&Value.Params);
+				FParamsSerializer::Serialize(Context, ParamsArgs);
+				FImpulseCodec::Serialize(Context.GetBitStreamWriter(), Value.Impulse);
+			}
+		}
+
+		static void Deserialize(FNetSerializationContext& Context, const FNetDeserializeArgs& Args)
+		{
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+			Target.bApplying = Context.GetBitStreamReader()->ReadBool() ? 1 : 0;
+			if (Target.bApplying)
+			{
+				FNetDeserializeArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+				ParamsArgs.Target = NetSerializerValuePointer(&Target.Params);
+				FParamsSerializer::Deserialize(Context, ParamsArgs);
+				FImpulseCodec::Deserialize(Context.GetBitStreamReader(), Target.Impulse);
+			}
+			else
+			{
+				Target.Impulse = {};
+			}
+		}
+
+		static void Quantize(FNetSerializationContext& Context, const FNetQuantizeArgs& Args)
+		{
+			const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+
+			// Only quantize any params if they are actually being applied
+			Target.bApplying = FImpulseCodec::IsApplying(Source.*ImpulseMember) ? 1 : 0;
+			if (Target.bApplying)
+			{
+				FNetQuantizeArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+				ParamsArgs.Source = NetSerializerValuePointer(static_cast<const FHitReactInputParams*>(&Source));
+				ParamsArgs.Target = NetSerializerValuePointer(&Target.Params);
+				FParamsSerializer::Quantize(Context, ParamsArgs);
+				FImpulseCodec::Quantize(Source.*ImpulseMember, Target.Impulse);
+			}
+			else
+			{
+				Target.Impulse = {};
+			}
+		}
+
+		static void Dequantize(FNetSerializationContext& Context, const FNetDequantizeArgs& Args)
+		{
+			const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			SourceType& Target = *reinterpret_cast<SourceType*>(Args.Target);
+
+			// Like the legacy NetSerialize, the target is untouched when nothing was sent
+			if (Source.bApplying)
+			{
+				FNetDequantizeArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+				ParamsArgs.Source = NetSerializerValuePointer(&Source.Params);
+				ParamsArgs.Target = NetSerializerValuePointer(static_cast<FHitReactInputParams*>(&Target));
+				FParamsSerializer::Dequantize(Context, ParamsArgs);
+				FImpulseCodec::Dequantize(Source.Impulse, Target.*ImpulseMember);
+			}
+		}
+
+		static bool IsEqual(FNetSerializationContext& Context, const FNetIsEqualArgs& Args)
+		{
+			FNetIsEqualArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+
+			if (Args.bStateIsQuantized)
+			{
+				const QuantizedType& Value0 = *reinterpret_cast<const QuantizedType*>(Args.Source0);
+				const QuantizedType& Value1 = *reinterpret_cast<const QuantizedType*>(Args.Source1);
+				if (Value0.bApplying != Value1.bApplying)
+				{
+					return false;
+				}
+				if (!Value0.bApplying)
+				{
+					return true;
+				}
+
+				ParamsArgs.Source0 = NetSerializerValuePointer(&Value0.Params);
+				ParamsArgs.Source1 = NetSerializerValuePointer(&Value1.Params);
+				return FImpulseCodec::IsQuantizedEqual(Value0.Impulse, Value1.Impulse) && FParamsSerializer::IsEqual(Context, ParamsArgs);
+			}
+
+			const SourceType& Value0 = *reinterpret_cast<const SourceType*>(Args.Source0);
+			const SourceType& Value1 = *reinterpret_cast<const SourceType*>(Args.Source1);
+			ParamsArgs.Source0 = NetSerializerValuePointer(static_cast<const FHitReactInputParams*>(&Value0));
+			ParamsArgs.Source1 = NetSerializerValuePointer(static_cast<const FHitReactInputParams*>(&Value1));
+			return FImpulseCodec::IsEqual(Value0.*ImpulseMember, Value1.*ImpulseMember) && FParamsSerializer::IsEqual(Context, ParamsArgs);
+		}
+
+		static bool Validate(FNetSerializationContext& Context, const FNetValidateArgs& Args)
+		{
+			const SourceType& Source = *reinterpret_cast<const SourceType*>(Args.Source);
+			FNetValidateArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+			ParamsArgs.Source = NetSerializerValuePointer(static_cast<const FHitReactInputParams*>(&Source));
+			return FImpulseCodec::Validate(Source.*ImpulseMember) && FParamsSerializer::Validate(Context, ParamsArgs);
+		}
+
+		static void CloneDynamicState(FNetSerializationContext& Context, const FNetCloneDynamicStateArgs& Args)
+		{
+			const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			QuantizedType& Target = *reinterpret_cast<QuantizedType*>(Args.Target);
+			FNetCloneDynamicStateArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+			ParamsArgs.Source = NetSerializerValuePointer(&Source.Params);
+			ParamsArgs.Target = NetSerializerValuePointer(&Target.Params);
+			FParamsSerializer::CloneDynamicState(Context, ParamsArgs);
+		}
+
+		static void FreeDynamicState(FNetSerializationContext& Context, const FNetFreeDynamicStateArgs& Args)
+		{
+			QuantizedType& Source = *reinterpret_cast<QuantizedType*>(Args.Source);
+			FNetFreeDynamicStateArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+			ParamsArgs.Source = NetSerializerValuePointer(&Source.Params);
+			FParamsSerializer::FreeDynamicState(Context, ParamsArgs);
+		}
+
+		static void CollectNetReferences(FNetSerializationContext& Context, const FNetCollectReferencesArgs& Args)
+		{
+			const QuantizedType& Source = *reinterpret_cast<const QuantizedType*>(Args.Source);
+			if (Source.bApplying)
+			{
+				FNetCollectReferencesArgs ParamsArgs = HitReactIris::MakeNestedArgs(Args, &FParamsSerializer::TriggerConfig);
+				ParamsArgs.Source = NetSerializerValuePointer(&Source.Params);
+				FParamsSerializer::CollectNetReferences(Context, ParamsArgs);
+			}
+		}
+	};
+
+	struct FHitReactTriggerNetSerializer : THitReactTriggerNetSerializer<FHitReactTrigger, FHitReactImpulseParams, &FHitReactTrigger::Impulse> {};
+	struct FHitReactTriggerLinearNetSerializer : THitReactTriggerNetSerializer<FHitReactTrigger_Linear, FHitReactImpulse_Linear, &FHitReactTrigger_Linear::LinearImpulse> {};
+	struct FHitReactTriggerAngularNetSerializer : THitReactTriggerNetSerializer<FHitReactTrigger_Angular, FHitReactImpulse_Angular, &FHitReactTrigger_Angular::AngularImpulse> {};
+	struct FHitReactTriggerRadialNetSerializer : THitReactTriggerNetSerializer<FHitReactTrigger_Radial, FHitReactImpulse_Radial, &FHitReactTrigger_Radial::RadialImpulse> {};
+
+	UE_NET_DECLARE_SERIALIZER(FHitReactTriggerNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactTriggerLinearNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactTriggerAngularNetSerializer, );
+	UE_NET_DECLARE_SERIALIZER(FHitReactTriggerRadialNetSerializer, );
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTriggerNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTriggerLinearNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTriggerAngularNetSerializer);
+	UE_NET_IMPLEMENT_SERIALIZER(FHitReactTriggerRadialNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulse("HitReactImpulse");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse, FHitReactImpulseNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseLinear("HitReactImpulse_Linear");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseLinear, FHitReactImpulseLinearNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseAngular("HitReactImpulse_Angular");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseAngular, FHitReactImpulseAngularNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseRadial("HitReactImpulse_Radial");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseRadial, FHitReactImpulseRadialNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseParams("HitReactImpulseParams");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams, FHitReactImpulseParamsNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactImpulseWorldParams("HitReactImpulse_WorldParams");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseWorldParams, FHitReactImpulseWorldParamsNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactInputParams("HitReactInputParams");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams, FHitReactInputParamsNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTrigger("HitReactTrigger");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger, FHitReactTriggerNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTriggerLinear("HitReactTrigger_Linear");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerLinear, FHitReactTriggerLinearNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTriggerAngular("HitReactTrigger_Angular");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerAngular, FHitReactTriggerAngularNetSerializer);
+
+	static const FName PropertyNetSerializerRegistry_NAME_HitReactTriggerRadial("HitReactTrigger_Radial");
+	UE_NET_IMPLEMENT_NAMED_STRUCT_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerRadial, FHitReactTriggerRadialNetSerializer);
+
+	/** Registers the serializers with Iris before the registry is frozen */
+	class FHitReactNetSerializerRegistryDelegates final : private FNetSerializerRegistryDelegates
+	{
+	public:
+		virtual ~FHitReactNetSerializerRegistryDelegates() override
+		{
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseLinear);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseAngular);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseRadial);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseWorldParams);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerLinear);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerAngular);
+			UE_NET_UNREGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerRadial);
+		}
+
+	private:
+		virtual void OnPreFreezeNetSerializerRegistry() override
+		{
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulse);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseLinear);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseAngular);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseRadial);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseParams);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactImpulseWorldParams);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactInputParams);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTrigger);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerLinear);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerAngular);
+			UE_NET_REGISTER_NETSERIALIZER_INFO(PropertyNetSerializerRegistry_NAME_HitReactTriggerRadial);
+		}
+
+		virtual void OnPostFreezeNetSerializerRegistry() override
+		{
+			FHitReactInputParamsNetSerializer::CheckNestedStorage();
+		}
+	};
+
+	static FHitReactNetSerializerRegistryDelegates HitReactNetSerializerRegistryDelegates;
+}
+
+#endif  // UE_WITH_IRIS
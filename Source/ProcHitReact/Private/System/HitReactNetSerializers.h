@@ -0,0 +1,50 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Iris/Serialization/NetSerializerConfig.h"
+#include "HitReactNetSerializers.generated.h"
+
+/*
+ * Iris NetSerializers for the impulse, input params and trigger structs, which would otherwise use the slow last resort path
+ * These mirror the legacy NetSerialize, including compact net params and packed world params
+ */
+
+USTRUCT()
+struct FHitReactImpulseNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FHitReactImpulseParamsNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FHitReactImpulseWorldParamsNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FHitReactInputParamsNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+
+	/** Serialize the bone data, triggers don't */
+	UPROPERTY()
+	bool bIncludeBoneData = true;
+
+	/** Serialize the impulse bone, triggers don't */
+	UPROPERTY()
+	bool bIncludeImpulseBone = true;
+};
+
+USTRUCT()
+struct FHitReactTriggerNetSerializerConfig : public FNetSerializerConfig
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,302 @@
+// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactProfileCache.h"
+
+#include "HitReactProfile.h"
+#include "HitReactTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactProfileCache)
+
+namespace FHitReactProfileCacheCVars
+{
+	static float ProfileIdleTime = 60.f;
+	FAutoConsoleVariableRef CVarProfileIdleTime(
+		TEXT("p.HitReact.ProfileCache.IdleTime"),
+		ProfileIdleTime,
+		TEXT("Lazily loaded hit react profiles that have not been used for this many seconds are released. 0 to never release idle profiles.\n"),
+		ECVF_Default);
+
+	static int32 ProfileBudgetKB = 512;
+	FAutoConsoleVariableRef CVarProfileBudgetKB(
+		TEXT("p.HitReact.ProfileCache.BudgetKB"),
+		ProfileBudgetKB,
+		TEXT("Memory budget for lazily loaded hit react profiles. The least recently used profiles are released while exceeding the budget. 0 for no budget.\n"),
+		ECVF_Default);
+
+	static float ProfileMinResidentTime = 2.f;
+	FAutoConsoleVariableRef CVarProfileMinResidentTime(
+		TEXT("p.HitReact.ProfileCache.MinResidentTime"),
+		ProfileMinResidentTime,
+		TEXT("Lazily loaded hit react profiles used within this many seconds are never released to meet the memory budget.\n"),
+		ECVF_Default);
+
+	static FAutoConsoleCommand CmdDumpProfiles(
+		TEXT("p.HitReact.ProfileCache.Dump"),
+		TEXT("Log all hit react profiles in the shared profile cache"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			if (const UHitReactProfileCache* Cache = UHitReactProfileCache::Get())
+			{
+				Cache->DumpProfiles();
+			}
+		}));
+}
+
+/** How often to check for profiles to release */
+static constexpr float HitReactProfileEvictionInterval = 1.f;
+
+UHitReactProfileCache* UHitReactProfileCache::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UHitReactProfileCache>() : nullptr;
+}
+
+void UHitReactProfileCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	EvictionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &ThisClass::TickEviction), HitReactProfileEvictionInterval);
+}
+
+void UHitReactProfileCache::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(EvictionTickerHandle);
+	EvictionTickerHandle.Reset();
+
+	for (TPair<FSoftObjectPath, FHitReactResidentProfile>& Pair : Profiles)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->CancelHandle();
+		}
+	}
+	Profiles.Reset();
+	ResidentBytes = 0;
+
+	Super::Deinitialize();
+}
+
+const UHitReactProfile* UHitReactProfileCache::UseProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile)
+{
+	const FSoftObjectPath& ProfilePath = SoftProfile.ToSoftObjectPath();
+	if (ProfilePath.IsNull())
+	{
+		return nullptr;
+	}
+
+	FHitReactResidentProfile* Resident = Profiles.Find(ProfilePath);
+	if (!Resident || !Resident->Profile)
+	{
+		// Already in memory, e.g. referenced elsewhere -- adopt it without loading
+		const UHitReactProfile* LoadedProfile = SoftProfile.Get();
+		if (!LoadedProfile)
+		{
+			return nullptr;
+		}
+
+		Resident = &Profiles.FindOrAdd(ProfilePath);
+		MakeResident(*Resident, LoadedProfile);
+	}
+
+	Resident->LastUseTime = FPlatformTime::Seconds();
+	Resident->UseCount++;
+	return Resident->Profile;
+}
+
+bool UHitReactProfileCache::RequestProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile,
+	const FSimpleDelegate& OnLoaded)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactProfileCache::RequestProfile);
+
+	const FSoftObjectPath ProfilePath = SoftProfile.ToSoftObjectPath();
+	if (ProfilePath.IsNull())
+	{
+		return false;
+	}
+
+	FHitReactResidentProfile& Resident = Profiles.FindOrAdd(ProfilePath);
+	if (Resident.bFailed)
+	{
+		return false;
+	}
+
+	// Already resident
+	if (Resident.Profile)
+	{
+		OnLoaded.ExecuteIfBound();
+		return true;
+	}
+
+	Resident.OnLoaded.Add(OnLoaded);
+
+	// Already loading
+	if (Resident.Handle.IsValid())
+	{
+		return true;
+	}
+
+	// The streamable manager may complete immediately, so don't hold onto Resident across this call
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ProfilePath,
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnProfileLoaded, ProfilePath),
+		FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("HitReactProfileCache"));
+
+	if (FHitReactResidentProfile* Loading = Profiles.Find(ProfilePath); Loading && !Loading->Profile && !Loading->bFailed)
+	{
+		Loading->Handle = Handle;
+	}
+	return true;
+}
+
+bool UHitReactProfileCache::HasProfileFailed(const TSoftObjectPtr<UHitReactProfile>& SoftProfile) const
+{
+	const FHitReactResidentProfile* Resident = Profiles.Find(SoftProfile.ToSoftObjectPath());
+	return Resident && Resident->bFailed;
+}
+
+uint32 UHitReactProfileCache::GetProfileUseCount(const TSoftObjectPtr<UHitReactProfile>& SoftProfile) const
+{
+	const FHitReactResidentProfile* Resident = Profiles.Find(SoftProfile.ToSoftObjectPath());
+	return Resident ? Resident->UseCount : 0;
+}
+
+void UHitReactProfileCache::OnProfileLoaded(FSoftObjectPath ProfilePath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactProfileCache::OnProfileLoaded);
+
+	FHitReactResidentProfile* Resident = Profiles.Find(ProfilePath);
+	if (!Resident)
+	{
+		return;
+	}
+
+	Resident->Handle.Reset();
+
+	if (!Resident->Profile)
+	{
+		if (const UHitReactProfile* LoadedProfile = Cast<UHitReactProfile>(ProfilePath.ResolveObject()))
+		{
+			MakeResident(*Resident, LoadedProfile);
+		}
+		else
+		{
+			Resident->bFailed = true;
+			UE_LOG(LogHitReact, Warning, TEXT("HitReactProfileCache: Failed to load profile { %s }"), *ProfilePath.ToString());
+		}
+	}
+
+	// Callbacks may request other profiles, don't hold onto Resident while executing them
+	TArray<FSimpleDelegate> Callbacks = MoveTemp(Resident->OnLoaded);
+	Resident->OnLoaded.Reset();
+	for (const FSimpleDelegate& Callback : Callbacks)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+void UHitReactProfileCache::MakeResident(FHitReactResidentProfile& Resident, const UHitReactProfile* Profile)
+{
+	// Estimate the memory used by the profile
+	FArchiveCountMem CountMem(const_cast<UHitReactProfile*>(Profile));
+
+	Resident.Profile = Profile;
+	Resident.SizeBytes = CountMem.GetMax();
+	Resident.LastUseTime = FPlatformTime::Seconds();
+	Resident.UseCount = 0;
+	ResidentBytes += Resident.SizeBytes;
+
+	UE_LOG(LogHitReact, Verbose, TEXT("HitReactProfileCache: Profile { %s } is resident ( %llu bytes )"),
+		*GetNameSafe(Profile), static_cast<uint64>(Resident.SizeBytes));
+}
+
+void UHitReactProfileCache::ReleaseProfile(const FSoftObjectPath& ProfilePath)
+{
+	FHitReactResidentProfile Resident;
+	if (Profiles.RemoveAndCopyValue(ProfilePath, Resident))
+	{
+		ResidentBytes -= FMath::Min(ResidentBytes, Resident.SizeBytes);
+
+		UE_LOG(LogHitReact, Verbose, TEXT("HitReactProfileCache: Released profile { %s } after %u uses"),
+			*ProfilePath.ToString(), Resident.UseCount);
+	}
+}
+
+void UHitReactProfileCache::ReleaseUnusedProfiles()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UHitReactProfileCache::ReleaseUnusedProfiles);
+
+	const double Now = FPlatformTime::Seconds();
+	const double IdleTime = FHitReactProfileCacheCVars::ProfileIdleTime;
+	const SIZE_T BudgetBytes = static_cast<SIZE_T>(FMath::Max(0, FHitReactProfileCacheCVars::ProfileBudgetKB)) * 1024;
+
+	// Gather resident profiles, releasing any that have been idle for too long
+	TArray<TPair<double, FSoftObjectPath>, TInlineAllocator<32>> LeastRecentlyUsed;
+	TArray<FSoftObjectPath, TInlineAllocator<8>> IdleProfiles;
+	for (const TPair<FSoftObjectPath, FHitReactResidentProfile>& Pair : Profiles)
+	{
+		const FHitReactResidentProfile& Resident = Pair.Value;
+		if (!Resident.Profile)
+		{
+			continue;  // Loading or failed
+		}
+
+		if (IdleTime > 0.0 && Now - Resident.LastUseTime > IdleTime)
+		{
+			IdleProfiles.Add(Pair.Key);
+		}
+		else
+		{
+			LeastRecentlyUsed.Emplace(Resident.LastUseTime, Pair.Key);
+		}
+	}
+
+	for (const FSoftObjectPath& ProfilePath : IdleProfiles)
+	{
+		ReleaseProfile(ProfilePath);
+	}
+
+	// Release the least recently used profiles until we're within budget
+	if (BudgetBytes > 0 && ResidentBytes > BudgetBytes)
+	{
+		LeastRecentlyUsed.Sort([](const TPair<double, FSoftObjectPath>& A, const TPair<double, FSoftObjectPath>& B)
+		{
+			return A.Key < B.Key;
+		});
+
+		for (const TPair<double, FSoftObjectPath>& Pair : LeastRecentlyUsed)
+		{
+			// Sorted oldest first, so everything remaining has been used too recently to release
+			if (ResidentBytes <= BudgetBytes || Now - Pair.Key < FHitReactProfileCacheCVars::ProfileMinResidentTime)
+			{
+				break;
+			}
+			ReleaseProfile(Pair.Value);
+		}
+	}
+}
+
+bool UHitReactProfileCache::TickEviction(float DeltaTime)
+{
+	ReleaseUnusedProfiles();
+	return true;
+}
+
+void UHitReactProfileCache::DumpProfiles() const
+{
+	const double Now = FPlatformTime::Seconds();
+	UE_LOG(LogHitReact, Log, TEXT("HitReactProfileCache: %d profiles, %llu bytes resident"),
+		Profiles.Num(), static_cast<uint64>(ResidentBytes));
+
+	for (const TPair<FSoftObjectPath, FHitReactResidentProfile>& Pair : Profiles)
+	{
+		const FHitReactResidentProfile& Resident = Pair.Value;
+		const TCHAR* State = Resident.bFailed ? TEXT("Failed") : Resident.Profile ? TEXT("Resident") : TEXT("Loading");
+		UE_LOG(LogHitReact, Log, TEXT("    %s [ %s ] Uses: %u Idle: %.1fs Size: %llu"), *Pair.Key.ToString(), State,
+			Resident.UseCount, Resident.Profile ? Now - Resident.LastUseTime : 0.0, static_cast<uint64>(Resident.SizeBytes));
+	}
+}
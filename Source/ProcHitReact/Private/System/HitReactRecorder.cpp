@@ -0,0 +1,215 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "System/HitReactRecorder.h"
+
+#include "HitReact.h"
+#include "HitReactTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Misc/FileHelper.h"
+
+#if !UE_BUILD_SHIPPING
+namespace FHitReactRecorderCVars
+{
+	static FAutoConsoleCommand CmdRecordStart(
+		TEXT("p.HitReact.Record.Start"),
+		TEXT("Start recording accepted hit reacts. Optionally specify a filename, relative to Saved/HitReact"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const FString Name = Args.Num() > 0 ? Args[0] :
+				FString::Printf(TEXT("HitReact_%s.hrrc"), *FDateTime::Now().ToString());
+			FHitReactRecorder::Get().Start(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HitReact"), Name));
+		}));
+
+	static FAutoConsoleCommand CmdRecordStop(
+		TEXT("p.HitReact.Record.Stop"),
+		TEXT("Stop recording hit reacts and save the recording"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FHitReactRecorder::Get().Stop();
+		}));
+}
+#endif
+
+bool FHitReactRecorder::bRecording = false;
+
+void FHitReactRecordedHit::Serialize(FArchive& Ar)
+{
+	bool bSuccess = true;
+	Ar << Time;
+	Ar << ComponentId;
+	Params.NetSerialize(Ar, nullptr, bSuccess);
+	Impulse.NetSerialize(Ar, nullptr, bSuccess);
+	World.NetSerialize(Ar, nullptr, bSuccess);
+	Ar << World.bNetRadialRelative;
+	Ar << ImpulseScalar;
+}
+
+void FHitReactRecording::Serialize(FArchive& Ar)
+{
+	uint32 FileMagic = Magic;
+	uint32 FileVersion = Version;
+	Ar << FileMagic;
+	Ar << FileVersion;
+	if (Ar.IsLoading() && (FileMagic != Magic || FileVersion != Version))
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << Components;
+
+	int32 NumHits = Hits.Num();
+	Ar << NumHits;
+	if (Ar.IsLoading())
+	{
+		if (NumHits < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		Hits.SetNum(NumHits);
+	}
+
+	for (FHitReactRecordedHit& Hit : Hits)
+	{
+		Hit.Serialize(Ar);
+		if (Ar.IsError())
+		{
+			return;
+		}
+	}
+}
+
+void FHitReactRecording::SortHits()
+{
+	// Queued hit reacts are recorded when applied, but timed from when they were requested
+	Hits.StableSort([](const FHitReactRecordedHit& A, const FHitReactRecordedHit& B)
+	{
+		return A.Time < B.Time;
+	});
+}
+
+bool FHitReactRecording::SaveToFile(const FString& Filename)
+{
+	SortHits();
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	Serialize(Writer);
+	return !Writer.IsError() && FFileHelper::SaveArrayToFile(Bytes, *Filename);
+}
+
+bool FHitReactRecording::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Serialize(Reader);
+	if (Reader.IsError())
+	{
+		return false;
+	}
+
+	// Recordings are sorted when saved, but don't rely on whoever wrote the file
+	SortHits();
+	return true;
+}
+
+FHitReactRecorder& FHitReactRecorder::Get()
+{
+	static FHitReactRecorder Recorder;
+	return Recorder;
+}
+
+void FHitReactRecorder::Start(const FString& InFilename)
+{
+	Recording = {};
+	ComponentIds.Reset();
+	WorldStartTimes.Reset();
+	Filename = InFilename;
+	StartTime = FPlatformTime::Seconds();
+	bRecording = true;
+
+	UE_LOG(LogHitReact, Log, TEXT("HitReactRecorder: Recording to { %s }"), *Filename);
+}
+
+bool FHitReactRecorder::Stop()
+{
+	if (!bRecording)
+	{
+		return false;
+	}
+	bRecording = false;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	const bool bSaved = Recording.SaveToFile(Filename);
+
+	UE_LOG(LogHitReact, Log, TEXT("HitReactRecorder: %s %d hit reacts on %d components to { %s }"),
+		bSaved ? TEXT("Saved") : TEXT("Failed to save"), Recording.Hits.Num(), Recording.Components.Num(), *Filename);
+
+	Recording = {};
+	ComponentIds.Reset();
+	WorldStartTimes.Reset();
+	return bSaved;
+}
+
+void FHitReactRecorder::Record(const UHitReact* Component, const FHitReactInputParams& Params,
+	const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& WorldParams, float ImpulseScalar, float HitTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHitReactRecorder::Record);
+
+	const AActor* Owner = Component ? Component->GetOwner() : nullptr;
+	const UWorld* World = Component ? Component->GetWorld() : nullptr;
+	if (!bRecording || !Owner || !World)
+	{
+		return;
+	}
+
+	// Time each world by its own clock so replays follow time dilation and pauses, the recording starts from whenever
+	// the first hit react in the world arrives, relative to when recording started
+	const double* WorldStartTime = WorldStartTimes.Find(World);
+	if (!WorldStartTime)
+	{
+		WorldStartTime = &WorldStartTimes.Add(World, World->GetTimeSeconds() - (FPlatformTime::Seconds() - StartTime));
+	}
+
+	uint32* ComponentId = ComponentIds.Find(Component);
+	if (!ComponentId)
+	{
+		FHitReactRecordedComponent& Recorded = Recording.Components.AddDefaulted_GetRef();
+		Recorded.OwnerClass = Owner->GetClass();
+		Recorded.ComponentClass = Component->GetClass();
+		Recorded.OwnerTransform = Owner->GetActorTransform();
+		ComponentId = &ComponentIds.Add(Component, Recording.Components.Num() - 1);
+	}
+
+	FHitReactRecordedHit& Hit = Recording.Hits.AddDefaulted_GetRef();
+	Hit.ComponentId = *ComponentId;
+
+	// Queued hit reacts are timed from when they were requested
+	Hit.Time = FMath::Max(0.f, static_cast<float>(HitTime - *WorldStartTime));
+
+	Hit.Params = Params;
+	Component->MakeCompactNetParams(Hit.Params);
+	Hit.Impulse = Impulse;
+	Hit.ImpulseScalar = ImpulseScalar;
+
+	// Replayed owners won't be where they were, so keep the radial impulse relative to them
+	Hit.World = WorldParams;
+	if (Impulse.RadialImpulse.bApplyImpulse && !Hit.World.bNetRadialRelative)
+	{
+		Hit.World.RadialLocation -= Owner->GetActorLocation();
+		Hit.World.bNetRadialRelative = true;
+	}
+}
@@ -14,6 +14,7 @@ public class ProcHitReact : ModuleRules
 			{
 				"Core",
 				"GameplayTags",
+				"NetCore",
 			}
 		);
 			
@@ -24,8 +25,13 @@ public class ProcHitReact : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"PhysicsCore",
+				"Chaos",
+				"IrisCore",
 			}
 		);
+
+		// Iris NetSerializers for the impulse structs, defines UE_WITH_IRIS
+		SetupIrisSupport(Target);
 		
 		if (Target.bBuildEditor)
 		{
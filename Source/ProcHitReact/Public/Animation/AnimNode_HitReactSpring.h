@@ -0,0 +1,106 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNodeBase.h"
+#include "Params/HitReactImpulse.h"
+#include "AnimNode_HitReactSpring.generated.h"
+
+class UHitReact;
+
+/**
+ * Damped spring state for a single bone
+ * Stored as a rotation vector in the space of the bone's parent, in radians
+ */
+struct PROCHITREACT_API FHitReactSpringBone
+{
+	FName BoneName = NAME_None;
+	FVector Angle = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+};
+
+/**
+ * Physics-free hit reactions for distant or low LOD characters
+ * Hit reacts beyond the LODThreshold of a profile with bSpringFallback drive an analytic damped spring on the hit bone
+ * and its parents, applied as an additive rotation without simulating any rigid bodies
+ * Finds the UHitReact component on the owning actor, place it late in the anim graph so the reaction is not overwritten
+ */
+USTRUCT(BlueprintInternalUseOnly)
+struct PROCHITREACT_API FAnimNode_HitReactSpring : public FAnimNode_Base
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Links)
+	FPoseLink Source;
+
+	/** Natural frequency of the spring, higher values react and recover faster */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(PinHiddenByDefault, UIMin="0.1", ClampMin="0.1", UIMax="10", ForceUnits="Hz"))
+	float Frequency = 2.5f;
+
+	/** Lower values oscillate for longer, higher values return to rest with less overshoot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(PinHiddenByDefault, UIMin="0.05", ClampMin="0.05", UIMax="0.95", ClampMax="0.95"))
+	float DampingRatio = 0.35f;
+
+	/** Converts linear and radial impulses into the velocity of the hit bone, i.e. the inverse of its mass */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(PinHiddenByDefault, UIMin="0", ClampMin="0", UIMax="1"))
+	float LinearImpulseScale = 0.2f;
+
+	/** Converts angular impulses into the angular velocity of the hit bone, i.e. its inverse inertia */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(PinHiddenByDefault, UIMin="0", ClampMin="0", UIMax="1"))
+	float AngularImpulseScale = 0.05f;
+
+	/** Maximum rotation of any bone */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(PinHiddenByDefault, UIMin="0", ClampMin="0", UIMax="90", ForceUnits="deg"))
+	float MaxAngle = 35.f;
+
+	/** Number of parents above the hit bone that also react */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(UIMin="0", ClampMin="0", UIMax="6"))
+	int32 ChainDepth = 2;
+
+	/** Scales the reaction of each successive parent */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Spring, meta=(UIMin="0", ClampMin="0", UIMax="1", ClampMax="1"))
+	float ChainFalloff = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PinShownByDefault, UIMin="0", ClampMin="0", UIMax="1", ClampMax="1"))
+	float Alpha = 1.f;
+
+public:
+	// FAnimNode_Base interface
+	virtual void Initialize_AnyThread(const FAnimationInitializeContext& Context) override;
+	virtual void CacheBones_AnyThread(const FAnimationCacheBonesContext& Context) override;
+	virtual void Update_AnyThread(const FAnimationUpdateContext& Context) override;
+	virtual void Evaluate_AnyThread(FPoseContext& Output) override;
+	virtual void GatherDebugData(FNodeDebugData& DebugData) override;
+	virtual bool HasPreUpdate() const override { return true; }
+	virtual void PreUpdate(const UAnimInstance* InAnimInstance) override;
+	// End of FAnimNode_Base interface
+
+	/** @return True if any bone is still reacting */
+	bool IsActive() const { return Springs.Num() > 0; }
+
+	/** Add the angular velocity resulting from an impulse to the hit bone and its parents */
+	void AddImpulse(const USkeletalMeshComponent* Mesh, const FHitReactPendingImpulse& Impulse);
+
+	/**
+	 * Advance a damped spring by DeltaTime using its closed form solution, so it is stable at any frame rate
+	 * @param AngularFrequency Natural frequency in radians per second
+	 * @param DampingRatio Must be less than 1
+	 */
+	static void StepSpring(FVector& Angle, FVector& Velocity, float AngularFrequency, float DampingRatio, float DeltaTime);
+
+protected:
+	TWeakObjectPtr<UHitReact> HitReact;
+
+	/** True once we have searched the owner for a UHitReact component */
+	bool bSearchedForHitReact = false;
+
+	/** Bones currently reacting */
+	TArray<FHitReactSpringBone> Springs;
+
+	/** Serial of the next spring impulse on the UHitReact component this node has not read */
+	uint32 SpringImpulseSerial = 0;
+
+	/** Impulses read from the UHitReact component during PreUpdate */
+	TArray<FHitReactPendingImpulse> ConsumedImpulses;
+};
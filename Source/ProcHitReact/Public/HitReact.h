@@ -4,18 +4,31 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Containers/MpscQueue.h"
 #include "HitReactTypes.h"
 #include "Physics/HitReactPhysics.h"
+#include "Physics/HitReactBlendEvaluator.h"
+#include "Physics/HitReactBodySpatialIndex.h"
+#include "Physics/HitReactPhysicsPool.h"
+#include "UObject/ObjectKey.h"
 #include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
 #include "Params/HitReactImpulse.h"
 #include "Params/HitReactParams.h"
 #include "Params/HitReactTrigger.h"
 #include "ThirdParty/AsyncMixinProc.h"
+#include "System/HitReactNetHits.h"
 #include "System/HitReactVersioning.h"
+#include <atomic>
 #include "HitReact.generated.h"
 
+class AGameModeBase;
+class APlayerController;
+class FHitReactAsyncCallback;
 class UHitReactProfile;
 class UPhysicalAnimationComponent;
+class UPhysicsAsset;
+class USkeletalMesh;
 
 DECLARE_DYNAMIC_DELEGATE(FOnHitReactInitialized);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHitReactToggleStateChanged, EHitReactToggleState, NewState);
@@ -42,6 +55,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<TSoftObjectPtr<UHitReactProfile>> AvailableProfiles;
 
+	/**
+	 * How AvailableProfiles are loaded
+	 * Lazy loads each profile on first use via the shared UHitReactProfileCache, and queues the hit react until it has loaded
+	 * Useful when there are many profiles, most of which are never used by a given pawn
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	EHitReactProfileLoading ProfileLoading = EHitReactProfileLoading::Preload;
+
 	/** Hit react bone data available for use when applying hit reacts */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<TSoftObjectPtr<UHitReactBoneData>> AvailableBoneData;
@@ -57,6 +78,28 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="0", ClampMin="0", UIMax="1", Delta="0.01", ForceUnits="s"))
 	float Cooldown = 0.f;
 
+	/**
+	 * If true, hit reacts requested before the profiles have finished loading are queued and replayed once loaded
+	 * Replayed hit reacts are fast-forwarded by the time spent waiting, so they resume at the correct point in their blend
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	bool bQueueHitsWhileLoading = false;
+
+	/**
+	 * Maximum number of hit reacts to queue while profiles are loading
+	 * When exceeded, the oldest queued hit react is discarded
+	 * Lazily loaded profiles always queue their hit reacts until loaded
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="bQueueHitsWhileLoading || ProfileLoading == EHitReactProfileLoading::Lazy", UIMin="1", ClampMin="1", UIMax="32"))
+	int32 MaxPendingHits = 8;
+
+	/**
+	 * Maximum number of hit reacts queued from other threads via EnqueueHitReact that can wait to be applied
+	 * When exceeded, further hit reacts are discarded until the queue is applied at the start of the next tick
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="1", ClampMin="1", UIMax="256"))
+	int32 MaxEnqueuedHits = 64;
+
 	/**
 	 * These bones cannot be simulated
 	 * Attempting to simulate these bones will not necessarily fail,
@@ -65,6 +108,54 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<FName> BlacklistedBones = { "root", "pelvis" };
 	
+	/**
+	 * If true, hit reacts sent via BroadcastHitReact are replicated to clients through a ring buffer of recent hits
+	 * All hit reacts on the owner during a frame are sent as a single property update, instead of a multicast per hit
+	 * Enables replication for this component
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	bool bReplicateHits = false;
+
+	/** Maximum number of recent hit reacts kept in the replicated ring buffer, the oldest are discarded when exceeded */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="bReplicateHits", EditConditionHides, UIMin="1", ClampMin="1", UIMax="64"))
+	int32 MaxReplicatedHits = 16;
+
+	/** Replicated hit reacts that are older than this when received are discarded, e.g. when the owner becomes relevant */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(EditCondition="bReplicateHits", EditConditionHides, UIMin="0", ClampMin="0", UIMax="2", Delta="0.05", ForceUnits="s"))
+	float MaxReplicatedHitAge = 0.5f;
+
+	/**
+	 * If true, and the world ticks physics asynchronously, impulses are coalesced per body and pushed to the physics
+	 * thread as a single input per frame instead of being marshalled per impulse
+	 * Has no effect unless Project Settings > Physics > Tick Physics Async is enabled, see p.HitReact.AsyncPhysics
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	bool bUseAsyncPhysics = false;
+
+	/**
+	 * If true, physics collision is enabled on the mesh when the hit react system initializes, instead of by the first hit
+	 * The physics state is then kept between hit reacts instead of being destroyed when they complete, so hits never
+	 * create physics state mid-frame. Bodies remain kinematic and ignore all channels while no hit reacts are in progress
+	 * Only meshes without collision are kept warm, any other collision state already has a physics state
+	 * Alternatively call WarmPhysicsState at a quiet time, e.g. after spawning
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	bool bWarmPhysicsState = false;
+
+	/**
+	 * Maximum number of physics blends that can be active at once, storage for them is allocated up front
+	 * Hit reacts that require a physics blend fail while the limit is reached, see UHitReactProfile::MaxBlendHandling
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="1", ClampMin="1", UIMax="128"))
+	int32 MaxPhysicsBlends = 64;
+
+	/**
+	 * How the BoneBlendRate of each active physics blend determines how fast bones blend to their target weight
+	 * PerBody prevents a bone from changing rate when unrelated physics blends start or end, at a small cost per bone
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	EHitReactBoneBlendRate BoneBlendRateMode = EHitReactBoneBlendRate::Average;
+
 	/** Whether to apply hit reacts on dedicated servers */
 	UPROPERTY(Config, EditDefaultsOnly, BlueprintReadOnly, AdvancedDisplay, Category=HitReact)
 	bool bApplyHitReactOnDedicatedServer = false;
@@ -78,15 +169,116 @@ protected:
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category=HitReact)
 	TArray<FHitReactPhysics> PhysicsBlends;
 
+	/** Slots referencing PhysicsBlends, owns the storage for PhysicsBlends */
+	FHitReactPhysicsPool PhysicsBlendPool;
+
+	/** Bone overrides shared by the physics blends, keyed by profile and bone data */
+	TMap<TPair<TObjectKey<UHitReactProfile>, TObjectKey<UHitReactBoneData>>, TSharedPtr<const FHitReactBoneOverrides>> BoneOverridesCache;
+
+	/** Evaluates the blend weight of each physics blend, lanes are parallel to PhysicsBlends */
+	FHitReactBlendEvaluator BlendEvaluator;
+
+	/** True if PhysicsBlends were added, removed, or reordered since BlendEvaluator was built */
+	bool bBlendEvaluatorDirty = false;
+
+	/** Sum of the BoneBlendRate of each profile in PhysicsBlends, maintained as physics blends are added and removed */
+	float BoneBlendRateSum = 0.f;
+
 	/** We interpolate the amount of active per-bone blends for averaging, so changes in PhysicsBlends don't cause a snap */
 	UPROPERTY()
 	TMap<FName, float> SmoothedBoneWeights;
 	
+	/** Blend weight of each body on the mesh, gathered from PhysicsBlends and smoothed each tick */
+	FHitReactBodyBlendWeights BodyBlendWeights;
+
+	/** Bounds of each body on the mesh, for resolving world space hits to bones, refit at most once per frame */
+	FHitReactBodySpatialIndex BodySpatialIndex;
+
+	/** Simulate state of each body on the mesh, indexed by body index */
+	TArray<FHitReactBodySimState> BodySimStates;
+
+	/** Physics asset that BoneOverridesCache and BodySimStates were built from */
+	TObjectKey<UPhysicsAsset> BodiesPhysicsAsset;
+
+	/** Skeletal mesh that BoneOverridesCache and BodySimStates were built from */
+	TObjectKey<USkeletalMesh> BodiesSkeletalMesh;
+
+	/** Incremented each time simulate flips are applied, used to identify bodies touched by a physics blend this tick */
+	uint32 SimStateSerial = 1;
+
+	/** Number of simulate state changes made by the hit react system, see stat HitReact for the per-frame count */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	int32 NumSimulateFlips = 0;
+
+	/** True if any body managed by the hit react system is still simulating, e.g. waiting for MinSimulateTime */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	bool bHasSimulatingBodies = false;
+
+	/** Number of bodies managed by the hit react system that have a physics blend weight */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	int32 NumWeightedBodies = 0;
+
+	/** True if the mesh physics need to be finalized, because a body changed simulate state or the mesh was restored */
+	bool bMeshPhysicsDirty = false;
+
 	/** Pending impulse to apply on the next Tick */
 	UPROPERTY()
 	FHitReactPendingImpulse PendingImpulse;
 
-	/** Loaded profiles from AvailableProfiles ready to be used */
+	/**
+	 * Most recent hit reacts beyond the LODThreshold of profiles with bSpringFallback, read by FAnimNode_HitReactSpring
+	 * Retained rather than consumed, so every anim node and anim instance on the mesh reacts to each of them
+	 * Used as a ring, each impulse is stored at the index of its serial modulo the capacity
+	 */
+	UPROPERTY(Transient)
+	TArray<FHitReactPendingImpulse> SpringImpulses;
+
+	/** Number of spring impulses ever added, the serial of the next one */
+	uint32 NumSpringImpulses = 0;
+
+	/** Bound to FGameModeEvents::GameModePostLoginEvent on the server while bReplicateHits */
+	FDelegateHandle PostLoginHandle;
+
+	/** Hit reacts requested while profiles were loading, replayed in OnFinishedLoading */
+	UPROPERTY(Transient)
+	TArray<FHitReactQueuedHit> PendingHits;
+
+	/** Index of the oldest entry in PendingHits, once full the oldest is overwritten in place */
+	int32 PendingHitsHead = 0;
+
+	/** Hit reacts broadcast while their profile was loading on the server, sent once it has loaded */
+	UPROPERTY(Transient)
+	TArray<FHitReactQueuedHit> PendingBroadcasts;
+
+	/** Index of the oldest entry in PendingBroadcasts, once full the oldest is overwritten in place */
+	int32 PendingBroadcastsHead = 0;
+
+	/** Profiles being lazily loaded that we have bound a load callback for */
+	TSet<FSoftObjectPath> LoadingProfiles;
+
+	/** Hit reacts queued from any thread via EnqueueHitReact, applied at the start of the next tick */
+	TMpscQueue<FHitReactQueuedHit> EnqueuedHits;
+
+	/** Number of hit reacts in EnqueuedHits, including those still being queued */
+	std::atomic<int32> NumEnqueuedHits { 0 };
+
+	/** True while a game thread task to wake the component for EnqueuedHits is on its way */
+	std::atomic<bool> bEnqueuedWakePending { false };
+
+	/** Recent hit reacts replicated to clients, see bReplicateHits */
+	UPROPERTY(Replicated, Transient)
+	FHitReactNetHitArray NetHits;
+
+	/** Applies impulses on the physics thread, only valid when bUseAsyncPhysics is in effect */
+	FHitReactAsyncCallback* AsyncPhysicsCallback = nullptr;
+
+	/** True while applying a batch of hit reacts, PhysicsBlends is sorted once the batch completes */
+	bool bDeferBlendSort = false;
+
+	/**
+	 * Loaded profiles from AvailableProfiles ready to be used
+	 * Empty when using EHitReactProfileLoading::Lazy, which retrieves profiles from UHitReactProfileCache instead
+	 */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	TArray<TObjectPtr<const UHitReactProfile>> ActiveProfiles;
 
@@ -121,6 +313,13 @@ protected:
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	bool bConstraintProfileChanged;
 
+	/** Constraint profile currently applied to each constraint on the mesh, indexed by constraint index */
+	UPROPERTY(Transient)
+	TArray<FName> AppliedConstraintProfiles;
+
+	/** Index of the constraint joining each body to its parent, indexed by body index */
+	TArray<int32> BodyConstraintIndices;
+
 	/** True if the collision was changed, and should be reverted upon completion of all hit reacts */
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
 	bool bCollisionEnabledChanged;
@@ -129,6 +328,18 @@ protected:
 	UPROPERTY()
 	TEnumAsByte<ECollisionEnabled::Type> DefaultCollisionEnabled;
 
+	/** True if the physics state is kept between hit reacts, see bWarmPhysicsState */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	bool bPhysicsStateWarm = false;
+
+	/** True if the collision responses are ignored while the physics state is warm */
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category="HitReact|Internal")
+	bool bCollisionResponsesSuppressed = false;
+
+	/** Collision responses to restore when a hit react begins while the physics state is warm */
+	UPROPERTY(Transient)
+	FCollisionResponseContainer WarmCollisionResponses;
+
 	/** Mesh to simulate hit reactions on */
 	UPROPERTY(Transient, DuplicateTransient, BlueprintReadOnly, Category="HitReact|References")
 	TObjectPtr<USkeletalMeshComponent> Mesh;
@@ -152,6 +363,10 @@ public:
 
 public:
 	const TArray<FHitReactPhysics>& GetPhysicsBlends() const { return PhysicsBlends; }
+
+	/** @return Number of simulate state changes made by the hit react system, see stat HitReact for the per-frame count */
+	UFUNCTION(BlueprintPure, Category=HitReact)
+	int32 GetNumSimulateFlips() const { return NumSimulateFlips; }
 	
 public:
 	UHitReact(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
@@ -162,11 +377,149 @@ public:
 	 * @param Impulse The impulse parameters to apply
 	 * @param World The world space parameters to apply
 	 * @param ImpulseScalar Universal scalar to apply to all impulses included in ImpulseParams
-	 * @return True if the hit react was applied
+	 * @return True if the hit react was applied, or queued because profiles are still loading (see bQueueHitsWhileLoading)
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
 	bool HitReact(const FHitReactInputParams& Params, FHitReactImpulseParams Impulse,
 		const FHitReactImpulse_WorldParams& World, float ImpulseScalar = 1.f);
+
+	/**
+	 * Resolve the bone struck by a world space hit, and assign it as the SimulatedBoneName and ImpulseBoneName of Params
+	 * The nearest physics body to the hit is used, skipping BlacklistedBones and bones disabled by the profile or bone
+	 * data, unless the profile remaps them via RemapSimulatedBones -- the remap is then applied by HitReact as usual
+	 * Requires the mesh physics state, see bWarmPhysicsState
+	 * @param HitNormal Surface normal at the hit, disambiguates hits on the boundary between bodies. May be zero
+	 * @param MaxDistance Bodies further than this from the hit are ignored
+	 * @return False if no valid body was found, Params is unchanged
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	bool ResolveHitBones(UPARAM(ref) FHitReactInputParams& Params, const FVector& HitLocation, const FVector& HitNormal,
+		float MaxDistance = 50.f);
+
+protected:
+	/**
+	 * Apply a hit reaction that was requested at HitTime
+	 * The resulting blend is fast-forwarded by the time that has passed since HitTime
+	 * @param HitTime World time the hit react was requested at, or a negative value to use the current time
+	 * @return True if the hit react was applied
+	 */
+	bool ApplyHitReact(const FHitReactInputParams& Params, FHitReactImpulseParams Impulse,
+		const FHitReactImpulse_WorldParams& World, float ImpulseScalar, float HitTime);
+
+	/** Queue a hit react to be replayed once profiles have finished loading */
+	void QueuePendingHit(const FHitReactInputParams& Params, const FHitReactImpulseParams& Impulse,
+		const FHitReactImpulse_WorldParams& World, float ImpulseScalar, float HitTime);
+
+	/**
+	 * Retrieve a loaded profile for the hit react
+	 * @param bOutPending True if the profile is being lazily loaded, and the hit react should be queued
+	 */
+	const UHitReactProfile* FindProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile, bool& bOutPending);
+
+	/** Move the queued hit reacts out of PendingHits, oldest first */
+	void TakePendingHits(TArray<FHitReactQueuedHit>& OutHits);
+
+	/** Replay any hit reacts that were queued while profiles were loading */
+	void ReplayPendingHits();
+
+	/** Replay only the hit reacts that were queued while waiting on a lazily loaded profile */
+	void ReplayPendingHits(const FSoftObjectPath& ProfilePath);
+
+	/** Lazily load a profile, replaying the hit reacts and sending the broadcasts waiting on it once loaded */
+	void RequestLazyProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile);
+
+	/** Sort PhysicsBlends so parent bones are processed before child bones */
+	void SortPhysicsBlends();
+
+public:
+	/**
+	 * Trigger a batch of hit reactions, e.g. all hit reacts received in a single net update
+	 * Hit reacts are applied in the order they were requested, and PhysicsBlends is only sorted once
+	 * @return Number of hit reacts that were applied or queued
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	int32 HitReactBatch(const TArray<FHitReactQueuedHit>& Hits);
+
+	/**
+	 * Queue a hit reaction from any thread, e.g. async trace results or Mass processors
+	 * Queued hit reacts are applied via HitReactBatch at the start of the next tick, without marshalling each one to the
+	 * game thread. A sleeping component is woken once for all hit reacts queued before it next ticks
+	 * The caller is responsible for ensuring the component isn't destroyed while this is called
+	 * @param HitTime World time the hit react occurred at, or a negative value to use the time it is applied at
+	 * @return False if MaxEnqueuedHits are already waiting to be applied
+	 */
+	bool EnqueueHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World,
+		float ImpulseScalar = 1.f, float HitTime = -1.f);
+
+	/**
+	 * Apply all hit reacts queued via EnqueueHitReact, called at the start of each tick
+	 * @return Number of hit reacts that were applied or queued
+	 */
+	int32 ApplyEnqueuedHits();
+
+protected:
+	/** Discard all hit reacts queued via EnqueueHitReact without applying them */
+	void DiscardEnqueuedHits();
+
+public:
+	/**
+	 * Trigger a hit reaction on the server, and replicate it to clients along with any others this frame
+	 * The trigger and world params are replicated in their compact net representation
+	 * Profiles with a CullDistance are only sent to GetHitReactRecipients, profiles that aren't loaded on the server yet
+	 * are loaded through UHitReactProfileCache first, and the hit react is sent once loaded
+	 * Requires bReplicateHits
+	 * @return True if the hit react will be replicated
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=HitReact)
+	bool BroadcastHitReact(const FHitReactTrigger& Params, const FHitReactImpulse_WorldParams& World, float ImpulseScalar = 1.f);
+
+	/**
+	 * Gather the players that should receive a hit react using this profile
+	 * BroadcastHitReact sends to these via UHitReactClientRelay, instead of replicating to every connection
+	 * Excludes players the owner is not net relevant for, and those whose view is beyond the profile's CullDistance
+	 * Distance culling requires the profile to be loaded on the server, or resident in UHitReactProfileCache
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category=HitReact)
+	void GetHitReactRecipients(const TSoftObjectPtr<UHitReactProfile>& Profile, TArray<APlayerController*>& OutPlayers) const;
+
+protected:
+	/** Gather the players that should receive a hit react, see GetHitReactRecipients */
+	void GatherHitReactRecipients(float CullDistance, TArray<APlayerController*>& OutPlayers) const;
+
+	/** Send a hit react to clients, through UHitReactClientRelay if the profile culls by distance, otherwise NetHits */
+	void SendHitReact(const FHitReactQueuedHit& Hit, const UHitReactProfile* Profile);
+
+	/** Send the hit reacts that were broadcast while waiting on the profile to load */
+	void SendPendingBroadcasts(const FSoftObjectPath& ProfilePath);
+
+	/**
+	 * Retrieve the profile on the server for BroadcastHitReact, regardless of ProfileLoading
+	 * @param bOutPending True if the profile must be loaded through UHitReactProfileCache first
+	 */
+	const UHitReactProfile* FindBroadcastProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile, bool& bOutPending) const;
+
+public:
+
+	/** @return True if no local viewer would see the hit react, based on the profile's CullDistance and bCullWhenNotRendered */
+	bool IsCulledForLocalViewers(const UHitReactProfile* Profile) const;
+
+	/**
+	 * Retrieve hit reacts that should drive the physics-free spring fallback, each caller tracks what it has read
+	 * Called by FAnimNode_HitReactSpring on the game thread
+	 * @param InOutSerial Serial of the first impulse the caller has not read, advanced past the impulses retrieved
+	 */
+	void GetSpringImpulses(uint32& InOutSerial, TArray<FHitReactPendingImpulse>& OutImpulses) const;
+
+	/** @return Serial of the next spring impulse, callers start here to skip those added before they existed */
+	uint32 GetSpringImpulseSerial() const { return NumSpringImpulses; }
+
+	/**
+	 * Called on clients when replicated hit reacts are received
+	 * Converts their server HitTime to local world time, and discards those older than MaxReplicatedHitAge
+	 */
+	void ReceiveReplicatedHits(TArray<FHitReactQueuedHit>& Hits);
+
+public:
 		
 	/**
 	 * Trigger a hit reaction on the specified bone using FHitReactTrigger Params
@@ -215,11 +568,103 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact, meta=(DisplayName="Hit React Trigger (Radial)"))
 	bool HitReactTrigger_Radial(const FHitReactTrigger_Radial& Params, const FHitReactImpulse_WorldParams& World,
 		float ImpulseScalar = 1.f);
+
+	/**
+	 * Convert params to their compact net representation before replicating them, e.g. via a multicast
+	 * The profile and bone data are sent as indices into AvailableProfiles and AvailableBoneData, and the bones as
+	 * reference skeleton indices bit-packed to the skeleton's bone count
+	 * Anything that can't be converted is sent in full
+	 * @warning The receiving component must be of the same class, and its mesh must use the same skeleton
+	 */
+	void MakeCompactNetParams(FHitReactInputParams& Params) const;
+
+	/**
+	 * Convert a trigger to its compact net representation before replicating it
+	 * @see MakeCompactNetParams
+	 */
+	UFUNCTION(BlueprintPure, Category=HitReact)
+	FHitReactTrigger MakeCompactTrigger(const FHitReactTrigger& Trigger) const;
+
+	/**
+	 * Convert world params to their packed net representation before replicating them
+	 * Only the fields for impulses being applied are sent, directions are sent as quantized unit normals,
+	 * and the radial location is sent relative to the owner
+	 * @warning Directions are normalized, the impulse strength comes from the impulse params
+	 */
+	UFUNCTION(BlueprintPure, Category=HitReact)
+	FHitReactImpulse_WorldParams MakeCompactWorldParams(const FHitReactImpulse_WorldParams& World,
+		const FHitReactImpulseParams& Impulse) const;
+
+	/**
+	 * Resolve params that were received in their compact net representation
+	 * @return False if the indices don't match this component's class defaults or skeleton
+	 */
+	bool ResolveCompactNetParams(FHitReactInputParams& Params) const;
 	
+	virtual void OnRegister() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Add a UHitReactClientRelay to players as they join, so it has replicated by the time they are sent a hit react */
+	void OnPlayerPostLogin(AGameModeBase* GameMode, APlayerController* NewPlayer);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	void TickGlobalToggle(float DeltaTime);
 
+protected:
+	/** Gather the simulate thresholds of the profiles touching this body during the current tick */
+	void TouchBodySimState(const FBodyInstance* BI, const UHitReactProfile* Profile);
+
+	/**
+	 * Change the simulate state of every body that crossed its thresholds, in a single pass
+	 * Bodies that were not touched by a physics blend this tick are treated as having no weight
+	 * Updates NumWeightedBodies, and flags the mesh physics as dirty if anything changed
+	 * @return Number of bodies that changed simulate state
+	 */
+	int32 ApplySimulateFlips();
+
+	/**
+	 * Apply a constraint profile to the constraints of BoneName and every body below it
+	 * Constraints that already use the profile are skipped
+	 */
+	void ApplyConstraintProfileBelow(FName BoneName, FName ProfileName);
+
+	/** Revert every constraint changed by ApplyConstraintProfileBelow to the default profile */
+	void ResetConstraintProfiles();
+
+	/**
+	 * Remove a physics blend to make room for another, based on the Replace options of EHitReactMaxBlendHandling
+	 * Candidates are found in constant time, and fall back to the oldest physics blend if unavailable
+	 * @return True if a physics blend was evicted
+	 */
+	bool EvictPhysicsBlend(EHitReactMaxBlendHandling MaxBlendHandling);
+
+	/**
+	 * Refresh the active physics blend for the bone and profile based on UHitReactProfile::BlendMerge
+	 * @return True if a physics blend was merged, otherwise a new physics blend is required
+	 */
+	bool MergePhysicsBlend(const FName& BoneName, const UHitReactProfile* Profile);
+
+	/**
+	 * Gather the bodies affected by the bone overrides of the profile and bone data, and the body each bone resolves to
+	 * The result is cached and shared by every physics blend using the same profile and bone data
+	 * @param Profile May be null, in which case only BlacklistedBones and the bone data apply
+	 */
+	TSharedPtr<const FHitReactBoneOverrides> GetBoneOverrides(const UHitReactProfile* Profile, const UHitReactBoneData* BoneData);
+
+	/**
+	 * Reset the hit react system if the physics asset or skeletal mesh was swapped since BoneOverridesCache,
+	 * BodySimStates and the physics blends were built, they are indexed by body index and a different asset can have
+	 * different bodies even when their count is the same
+	 * @return True if they were reset
+	 */
+	bool ResetIfBodyAssetsChanged();
+
+public:
+
 	void ApplyImpulse(const FHitReactPendingImpulse& Impulse) const;
 	
 	void ApplyImpulse(const FHitReactImpulseParams& Impulse, const FHitReactImpulse_WorldParams& World, float ImpulseScalar,
@@ -314,6 +759,29 @@ public:
 	 * @return True if mesh needs to change to valid collision properties
 	 */
 	bool NeedsCollisionEnabled() const;
+
+	/**
+	 * Create the physics state now, so the first hit react doesn't, and keep it between hit reacts
+	 * Call at a quiet time, e.g. after spawning, or enable bWarmPhysicsState to call it when initialized
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintCosmetic, Category=HitReact)
+	void WarmPhysicsState();
+
+protected:
+	/** Change the mesh to a collision state with physics, which may create the physics state */
+	void EnablePhysicsCollision();
+
+	/**
+	 * Restore the collision enabled state once no hit reacts are in progress
+	 * Meshes without collision keep their physics state when it is warm, and ignore all channels instead
+	 */
+	void RestoreCollisionEnabled();
+
+	/** Ignore all collision channels while no hit reacts are in progress, if the mesh had no collision */
+	void SuppressCollisionResponses();
+
+	/** Restore the collision responses ignored by SuppressCollisionResponses */
+	void RestoreCollisionResponses();
 	
 public:
 	/** Get the mesh to simulate from the owner */
@@ -340,6 +808,10 @@ protected:
 	UFUNCTION()
 	virtual void OnMeshPoseInitialized();
 
+	/** Discards impulses pushed to the physics thread for bodies whose physics state is being destroyed */
+	UFUNCTION()
+	virtual void OnMeshPhysicsStateChanged(UPrimitiveComponent* ChangedComponent, EComponentPhysicsStateChange StateChange);
+
 	virtual void ResetHitReactSystem();
 	
 protected:
@@ -348,12 +820,29 @@ protected:
 
 	uint64 GetUniqueDrawDebugKey(int32 Offset) const { return (GetUniqueID() + Offset) % UINT32_MAX; }
 
+	/** @return Debug output enabled for this component by the p.HitReact.Debug cvars, evaluated once per frame */
+	uint8 GetDebugFlags() const;
+
 private:
 	/**
 	 * Notify user of the result of a hit react
 	 * Useful for debugging
 	 */
-	void DebugHitReactResult(const FString& Result, bool bFailed) const;
+	void DebugHitReactResult(const TCHAR* Result, bool bFailed) const;
+
+	/** @return Where the result of a hit react should be output, none if it shouldn't be formatted at all */
+	uint8 GetDebugResultOutputs(bool bFailed) const;
+
+	/** Output the result of a hit react to the outputs given by GetDebugResultOutputs() */
+	void OutputDebugResult(const TCHAR* Result, bool bFailed, uint8 Outputs) const;
+
+#if UE_ENABLE_DEBUG_DRAWING
+	/** Cached result of GetDebugFlags() */
+	mutable uint8 DebugFlags = 0;
+
+	/** Frame DebugFlags was cached on */
+	mutable uint64 DebugFlagsFrame = 0;
+#endif
 
 #if WITH_EDITOR
 #if UE_5_03_OR_LATER
@@ -35,7 +35,9 @@ public:
 	float MaxBlendWeight;
 
 	/**
-	 * How fast bones blend to the target weight -- this is averaged between all active hit reacts
+	 * How fast bones blend to the target weight -- this is averaged between all active hit reacts,
+	 * unless UHitReact::BoneBlendRateMode is PerBody, in which case each bone uses the rate of the hit react with the
+	 * most influence on it
 	 * This is typically blending a value of 0-1 so lower values are used
 	 * 
 	 * Values exceeding 10.f typically experience snapping as a result of almost no blending
@@ -66,6 +68,15 @@ public:
 	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact, meta=(UIMin="1", ClampMin="1", EditCondition="MaxBlendHandling != EHitReactMaxBlendHandling::Disabled", EditConditionHides))
 	int32 MaxActiveBlends;
+
+	/**
+	 * How to handle a hit react on a bone that already has an active physics blend from this profile
+	 * Merging refreshes the existing physics blend in place, so the number of physics blends grows with the number of
+	 * bones hit rather than the number of hits
+	 * Rewind uses DecayTime, DecayRate, and MaxAccumulatedDecayTime from BlendParams
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=HitReact)
+	EHitReactBlendMerge BlendMerge;
 	
 	/**
 	 * Scale the impulse based on the number of times the bone has been hit prior to completing the hit react
@@ -97,6 +108,27 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Physics)
 	FName PhysicalAnimProfile;
 
+	/**
+	 * Bodies begin simulating once their blend weight exceeds this
+	 * Together with SimulateDisableThreshold this prevents bodies from rapidly toggling simulation under overlapping hits
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Physics, meta=(UIMin="0", ClampMin="0", UIMax="0.2", ClampMax="1", Delta="0.005"))
+	float SimulateEnableThreshold;
+
+	/**
+	 * Bodies stop simulating once their blend weight falls to or below this
+	 * Should be lower than SimulateEnableThreshold, the gap between them is the hysteresis
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Physics, meta=(UIMin="0", ClampMin="0", UIMax="0.2", ClampMax="1", Delta="0.005"))
+	float SimulateDisableThreshold;
+
+	/**
+	 * Once a body begins simulating it will continue to simulate for at least this long
+	 * Changing the simulate state of a body is expensive, this prevents repeated changes under sustained fire
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Physics, meta=(UIMin="0", ClampMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	float MinSimulateTime;
+
 	/**
 	 * Constraint profile to apply to all bones
 	 * This is applied to the physics asset on the mesh
@@ -112,6 +144,29 @@ public:
 	*/
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance, meta=(DisplayName="LOD Threshold", ClampMin="-1", UIMin="-1"))
 	int32 LODThreshold;
+
+	/**
+	 * If true, hit reacts beyond the LODThreshold drive FAnimNode_HitReactSpring in the anim graph instead of being rejected
+	 * A cheap physics-free damped spring on the hit bone chain, for distant crowds
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance, meta=(EditCondition="LODThreshold >= 0"))
+	bool bSpringFallback;
+
+	/**
+	 * Hit reacts are not applied when every local viewer is further than this from the owner
+	 * Servers also exclude these viewers when gathering recipients via UHitReact::GetHitReactRecipients
+	 * 0 to disable
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance, meta=(UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float CullDistance;
+
+	/** If true, hit reacts are not applied unless the mesh was rendered within RecentlyRenderedTime */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance)
+	bool bCullWhenNotRendered;
+
+	/** Hit reacts are not applied unless the mesh was rendered within this time */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Performance, meta=(EditCondition="bCullWhenNotRendered", EditConditionHides, UIMin="0", ClampMin="0", Delta="0.05", ForceUnits="s"))
+	float RecentlyRenderedTime;
 	
 public:
 	UHitReactProfile()
@@ -120,14 +175,22 @@ public:
 		, Cooldown(0.05f)
 		, MaxBlendHandling(EHitReactMaxBlendHandling::Disabled)
 		, MaxActiveBlends(50)
+		, BlendMerge(EHitReactBlendMerge::Disabled)
 		, SubsequentImpulseScalars({
 			{ 0.1f, 0.35f },
 			{ 0.25f, 0.5f },
 			{ 0.35f, 0.7f },
 			{ 0.5f, 0.9f } })
 		, PhysicalAnimProfile(NAME_None)
+		, SimulateEnableThreshold(0.01f)
+		, SimulateDisableThreshold(0.005f)
+		, MinSimulateTime(0.1f)
 		, ConstraintProfile(NAME_None)
 		, LODThreshold(-1)
+		, bSpringFallback(false)
+		, CullDistance(0.f)
+		, bCullWhenNotRendered(false)
+		, RecentlyRenderedTime(0.2f)
 	{}
 
 #if WITH_EDITOR
@@ -23,10 +23,10 @@ class PROCHITREACT_API UHitReactStatics : public UBlueprintFunctionLibrary
 
 protected:
 	static bool DoAnyPhysicsBodiesHaveWeight(const USkeletalMeshComponent* Mesh);
-	static bool ShouldBlendPhysicsBones(const USkeletalMeshComponent* Mesh);
-	static bool ShouldRunEndPhysicsTick(const USkeletalMeshComponent* Mesh);
+	static bool ShouldBlendPhysicsBones(const USkeletalMeshComponent* Mesh, int32 NumWeightedBodies = INDEX_NONE);
+	static bool ShouldRunEndPhysicsTick(const USkeletalMeshComponent* Mesh, int32 NumWeightedBodies = INDEX_NONE);
 	static bool ShouldRunClothTick(const USkeletalMeshComponent* Mesh);
-	static void UpdateEndPhysicsTickRegisteredState(USkeletalMeshComponent* Mesh);
+	static void UpdateEndPhysicsTickRegisteredState(USkeletalMeshComponent* Mesh, int32 NumWeightedBodies = INDEX_NONE);
 	static void UpdateClothTickRegisteredState(USkeletalMeshComponent* Mesh);
 
 public:
@@ -37,12 +37,22 @@ public:
 	static int32 ForEach(USkeletalMeshComponent* Mesh, FName BoneName, bool bIncludeSelf, const TFunctionRef<bool(FBodyInstance*)>& Func);
 
 public:
-	/** Finalize the physics state of the mesh, must be called after modifying blend weights or simulate physics state */
-	static void FinalizeMeshPhysics(USkeletalMeshComponent* Mesh);
+	/**
+	 * Finalize the physics state of the mesh, must be called after modifying blend weights or simulate physics state
+	 * @param NumWeightedBodies Number of bodies the hit react system gave a physics blend weight if known
+	 *	Every body is checked when this is zero or unknown, as they may have been given weight elsewhere
+	 */
+	static void FinalizeMeshPhysics(USkeletalMeshComponent* Mesh, int32 NumWeightedBodies = INDEX_NONE);
 
 	/** Accumulate the blend weight for the given bone */
 	static bool AccumulateBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName, float BlendWeight, float ClampBlendWeight, float Alpha);
 
+	/**
+	 * Clamp, scale and apply the blend weight to the body without changing its simulate state
+	 * @return The applied blend weight
+	 */
+	static float ApplyBlendWeight(FBodyInstance* BI, float BlendWeight, float ClampBlendWeight = 1.f, float Alpha = 1.f);
+
 	/** Set the blend weight for the given bone */
 	static bool SetBlendWeight(const USkeletalMeshComponent* Mesh, const FName& BoneName, float BlendWeight, float ClampBlendWeight = 1.f, float Alpha = 1.f);
 
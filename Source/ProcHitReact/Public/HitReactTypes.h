@@ -3,10 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 #include "HitReactTypes.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogHitReact, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("HitReact"), STATGROUP_HitReact, STATCAT_Advanced);
+
 /**
  * Global toggle state for the hit reaction system
  */
@@ -19,10 +22,39 @@ enum class EHitReactToggleState : uint8
 	Enabled
 };
 
+/**
+ * How hit react profiles are loaded
+ */
+UENUM(BlueprintType)
+enum class EHitReactProfileLoading : uint8
+{
+	Preload				UMETA(ToolTip="Load all AvailableProfiles when the component activates and keep them loaded"),
+	Lazy				UMETA(ToolTip="Load each profile on first use via the shared profile cache, which releases profiles that are no longer used"),
+};
+
 UENUM(BlueprintType)
 enum class EHitReactMaxBlendHandling : uint8
 {
 	Disabled			UMETA(ToolTip="Apply the hit react regardless of how many blends are active"),
 	ImpulseOnly			UMETA(ToolTip="Only apply the impulse without modifying bone blend weights"),
 	Blocked				UMETA(ToolTip="Block the hit react if the maximum number of blends are active"),
+	ReplaceOldest			UMETA(ToolTip="Remove the oldest physics blend to make room for the hit react"),
+	ReplaceLowestWeight		UMETA(ToolTip="Remove the physics blend with the lowest blend weight to make room for the hit react"),
+	ReplaceFurthestBlendOut	UMETA(ToolTip="Remove the physics blend furthest along its blend out to make room for the hit react, or the oldest if none are blending out"),
+};
+
+UENUM(BlueprintType)
+enum class EHitReactBoneBlendRate : uint8
+{
+	Average				UMETA(ToolTip="Every bone blends at the average BoneBlendRate of all active physics blends"),
+	PerBody				UMETA(ToolTip="Each bone blends at the BoneBlendRate of the physics blend with the most influence on it, so physics blends starting or ending elsewhere don't change its rate"),
+};
+
+UENUM(BlueprintType)
+enum class EHitReactBlendMerge : uint8
+{
+	Disabled			UMETA(ToolTip="Always add a new physics blend, even if the bone already has an active physics blend from this profile"),
+	Restart				UMETA(ToolTip="Restart the active physics blend from the beginning of its blend in"),
+	ExtendHold			UMETA(ToolTip="Return the active physics blend to the start of its hold, if it has finished blending in"),
+	Rewind				UMETA(ToolTip="Rewind the active physics blend by DecayTime at DecayRate, accumulating up to MaxAccumulatedDecayTime"),
 };
\ No newline at end of file
@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 #include "HitReactImpulse.generated.h"
 
+class AActor;
 class UHitReactProfile;
+struct FHitReactImpulseParams;
 
 /**
  * Type of impulse to apply
@@ -40,6 +42,9 @@ enum class EHitReactFalloff : uint8
 
 /**
  * Base impulse params for applying hit reactions
+ * Impulse structs are not polymorphic so they remain trivially copyable
+ * Derived structs hide CanBeApplied and NetSerialize instead of overriding them, use the concrete type or
+ * FHitReactImpulseParams::CanBeApplied(EHitReactImpulseType) when the type is only known at runtime
  */
 USTRUCT(BlueprintType)
 struct PROCHITREACT_API FHitReactImpulse
@@ -51,7 +56,6 @@ struct PROCHITREACT_API FHitReactImpulse
 		, bFactorMass(false)
 		, Impulse(500.f)
 	{}
-	virtual ~FHitReactImpulse() = default;
 
 	/** If false, will not be applied */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Physics)
@@ -71,12 +75,12 @@ struct PROCHITREACT_API FHitReactImpulse
 	bool IsVelocityChange() const { return !bFactorMass; }
 
 	/** @return True if the impulse can be applied */
-	virtual bool CanBeApplied() const
+	bool CanBeApplied() const
 	{
 		return bApplyImpulse && Impulse > 0.f;
 	}
 
-	virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		Ar.SerializeBits(&bApplyImpulse, 1);
 		if (bApplyImpulse)
@@ -109,21 +113,10 @@ struct PROCHITREACT_API FHitReactImpulse_Linear : public FHitReactImpulse
 	{}
 
 	/** @return Impulse vector based on the given direction and impulse strength */
-	virtual FVector GetImpulse(const FVector& WorldDirection) const
+	FVector GetImpulse(const FVector& WorldDirection) const
 	{
 		return WorldDirection * Impulse;
 	}
-
-	virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override
-	{
-		Ar.SerializeBits(&bApplyImpulse, 1);
-		if (bApplyImpulse)
-		{
-			Ar.SerializeBits(&bFactorMass, 1);
-			Ar << Impulse;
-		}
-		return !Ar.IsError();
-	}
 };
 
 template<>
@@ -151,13 +144,11 @@ struct PROCHITREACT_API FHitReactImpulse_Angular : public FHitReactImpulse_Linea
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Physics, meta=(EditCondition="bApplyImpulse", EditConditionHides))
 	EHitReactUnits AngularUnits;
 	
-	virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
-		Ar.SerializeBits(&bApplyImpulse, 1);
+		FHitReactImpulse_Linear::NetSerialize(Ar, Map, bOutSuccess);
 		if (bApplyImpulse)
 		{
-			Ar.SerializeBits(&bFactorMass, 1);
-			Ar << Impulse;
 			Ar << AngularUnits;
 		}
 		return !Ar.IsError();
@@ -194,18 +185,16 @@ struct PROCHITREACT_API FHitReactImpulse_Radial : public FHitReactImpulse
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Physics, meta=(EditCondition="bApplyImpulse", EditConditionHides))
 	EHitReactFalloff Falloff;
 
-	virtual bool CanBeApplied() const override final
+	bool CanBeApplied() const
 	{
 		return FHitReactImpulse::CanBeApplied() && Radius > 0.f;
 	}
 	
-	virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
-		Ar.SerializeBits(&bApplyImpulse, 1);
+		FHitReactImpulse::NetSerialize(Ar, Map, bOutSuccess);
 		if (bApplyImpulse)
 		{
-			Ar.SerializeBits(&bFactorMass, 1);
-			Ar << Impulse;
 			Ar << Radius;
 			Ar << Falloff;
 		}
@@ -263,6 +252,18 @@ struct PROCHITREACT_API FHitReactImpulseParams
 	{
 		return LinearImpulse.CanBeApplied() || AngularImpulse.CanBeApplied() || RadialImpulse.CanBeApplied();
 	}
+
+	/** @return True if the impulse of the given type can be applied, dispatched to the concrete impulse type */
+	bool CanBeApplied(EHitReactImpulseType ImpulseType) const
+	{
+		switch (ImpulseType)
+		{
+		case EHitReactImpulseType::Linear: return LinearImpulse.CanBeApplied();
+		case EHitReactImpulseType::Angular: return AngularImpulse.CanBeApplied();
+		case EHitReactImpulseType::Radial: return RadialImpulse.CanBeApplied();
+		}
+		return false;
+	}
 };
 
 template<>
@@ -301,13 +302,35 @@ struct PROCHITREACT_API FHitReactImpulse_WorldParams
 	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadWrite, Category=Physics)
 	FVector RadialLocation;
 
-	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
-	{
-		LinearDirection.NetSerialize(Ar, Map, bOutSuccess);
-		AngularDirection.NetSerialize(Ar, Map, bOutSuccess);
-		RadialLocation.NetSerialize(Ar, Map, bOutSuccess);
-		return !Ar.IsError();
-	}
+	/**
+	 * Packed net representation, see MakeNetPacked
+	 * When packed, only the fields for impulses that are being applied are serialized, directions are sent as
+	 * octahedral unit normals, and the radial location is quantized relative to the owning actor
+	 */
+	bool bNetPacked = false;
+
+	/** RadialLocation is relative to the owning actor and must be resolved before use, see ResolveNetRelative */
+	bool bNetRadialRelative = false;
+
+	/** Which fields are serialized when packed */
+	uint8 NetFieldMask = 0;
+
+	static constexpr uint8 NetField_Linear = 1 << 0;
+	static constexpr uint8 NetField_Angular = 1 << 1;
+	static constexpr uint8 NetField_Radial = 1 << 2;
+
+	/**
+	 * Use the packed net representation
+	 * @warning Directions are normalized when packed, as the impulse strength is defined by the impulse params
+	 * @param Impulse Only the fields for impulses with bApplyImpulse will be serialized
+	 * @param Owner If valid, RadialLocation is sent relative to it, and must be resolved by the receiver
+	 */
+	void MakeNetPacked(const FHitReactImpulseParams& Impulse, const AActor* Owner);
+
+	/** Convert a relative RadialLocation received via the packed net representation back to world space */
+	void ResolveNetRelative(const AActor* Owner);
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 };
 
 template<>
@@ -162,18 +162,62 @@ struct PROCHITREACT_API FHitReactInputParams
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	bool bIncludeSelf;
 
+	/**
+	 * Compact net representation, see UHitReact::MakeCompactNetParams
+	 * When set, these are serialized in place of the profile and bone data paths, and the bone names
+	 */
+
+	/** Index into the class default AvailableProfiles of the receiving UHitReact */
+	int16 NetProfileIndex = INDEX_NONE;
+
+	/** Index into the class default AvailableBoneData of the receiving UHitReact */
+	int16 NetBoneDataIndex = INDEX_NONE;
+
+	/** Reference skeleton index of SimulatedBoneName */
+	int16 NetSimulatedBoneIndex = INDEX_NONE;
+
+	/** Reference skeleton index of ImpulseBoneName */
+	int16 NetImpulseBoneIndex = INDEX_NONE;
+
+	/** Number of bones in the reference skeleton, bone indices are bit-packed to this */
+	uint16 NetNumBones = 0;
+
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
-		Ar << Profile;
-		Ar << BoneData;
-		Ar << SimulatedBoneName;
-		Ar << ImpulseBoneName;
+		NetSerializeProfile(Ar, true);
+		NetSerializeBones(Ar, true);
 		Ar << bIncludeSelf;
 		return !Ar.IsError();
 	}
 
+	/** Serialize the profile, and optionally the bone data, as indices when compact or as paths otherwise */
+	void NetSerializeProfile(FArchive& Ar, bool bIncludeBoneData);
+
+	/** Serialize the simulated, and optionally the impulse bone, as bone indices when compact or as names otherwise */
+	void NetSerializeBones(FArchive& Ar, bool bIncludeImpulseBone);
+
+	/** @return True if any part of these params is in its compact net representation and must be resolved before use */
+	bool HasCompactNetIndices() const
+	{
+		return NetProfileIndex != INDEX_NONE || NetBoneDataIndex != INDEX_NONE || NetSimulatedBoneIndex != INDEX_NONE;
+	}
+
+	/** Clear the compact net representation, e.g. after resolving it */
+	void ResetCompactNetIndices()
+	{
+		NetProfileIndex = INDEX_NONE;
+		NetBoneDataIndex = INDEX_NONE;
+		NetSimulatedBoneIndex = INDEX_NONE;
+		NetImpulseBoneIndex = INDEX_NONE;
+		NetNumBones = 0;
+	}
+
 	operator bool() const { return IsValidToApply(); }
-	bool IsValidToApply() const { return !Profile.IsNull() && !SimulatedBoneName.IsNone(); }
+	bool IsValidToApply() const
+	{
+		return (!Profile.IsNull() || NetProfileIndex != INDEX_NONE) &&
+			(!SimulatedBoneName.IsNone() || NetSimulatedBoneIndex != INDEX_NONE);
+	}
 	
 	const FName& GetImpulseBoneName() const
 	{
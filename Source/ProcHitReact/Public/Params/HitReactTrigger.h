@@ -38,6 +38,11 @@ struct PROCHITREACT_API FHitReactTrigger : public FHitReactInputParams
 		, Impulse(InImpulse)
 	{}
 
+	FHitReactTrigger(const FHitReactInputParams& InParams, const FHitReactImpulseParams& InImpulse)
+		: Super(InParams)
+		, Impulse(InImpulse)
+	{}
+
 	/** The impulse parameters to apply */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	FHitReactImpulseParams Impulse;
@@ -45,16 +50,22 @@ struct PROCHITREACT_API FHitReactTrigger : public FHitReactInputParams
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		// Only serialize any params if they are actually being applied
-		if (Impulse.LinearImpulse || Impulse.AngularImpulse || Impulse.RadialImpulse)
+		uint8 bApplying = Ar.IsSaving() && (Impulse.LinearImpulse || Impulse.AngularImpulse || Impulse.RadialImpulse) ? 1 : 0;
+		Ar.SerializeBits(&bApplying, 1);
+		if (bApplying)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
+			NetSerializeProfile(Ar, false);
+			NetSerializeBones(Ar, false);
 			Ar << bIncludeSelf;
 			Impulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
 		return !Ar.IsError();
 	}
 
+	/**
+	 * @return The impulse of the given type as its base struct
+	 * @warning Impulses are not polymorphic, use Impulse.CanBeApplied(ImpulseType) rather than the base CanBeApplied()
+	 */
 	FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType);
 	const FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType) const;
 };
@@ -96,10 +107,12 @@ struct PROCHITREACT_API FHitReactTrigger_Linear : public FHitReactInputParams
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		// Only serialize any params if they are actually being applied
-		if (LinearImpulse)
+		uint8 bApplying = Ar.IsSaving() && (LinearImpulse) ? 1 : 0;
+		Ar.SerializeBits(&bApplying, 1);
+		if (bApplying)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
+			NetSerializeProfile(Ar, false);
+			NetSerializeBones(Ar, false);
 			Ar << bIncludeSelf;
 			LinearImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
@@ -147,10 +160,12 @@ struct PROCHITREACT_API FHitReactTrigger_Angular : public FHitReactInputParams
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		// Only serialize any params if they are actually being applied
-		if (AngularImpulse)
+		uint8 bApplying = Ar.IsSaving() && (AngularImpulse) ? 1 : 0;
+		Ar.SerializeBits(&bApplying, 1);
+		if (bApplying)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
+			NetSerializeProfile(Ar, false);
+			NetSerializeBones(Ar, false);
 			Ar << bIncludeSelf;
 			AngularImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
@@ -198,10 +213,12 @@ struct PROCHITREACT_API FHitReactTrigger_Radial : public FHitReactInputParams
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 	{
 		// Only serialize any params if they are actually being applied
-		if (RadialImpulse)
+		uint8 bApplying = Ar.IsSaving() && (RadialImpulse) ? 1 : 0;
+		Ar.SerializeBits(&bApplying, 1);
+		if (bApplying)
 		{
-			Ar << Profile;
-			Ar << SimulatedBoneName;
+			NetSerializeProfile(Ar, false);
+			NetSerializeBones(Ar, false);
 			Ar << bIncludeSelf;
 			RadialImpulse.NetSerialize(Ar, Map, bOutSuccess);
 		}
@@ -210,4 +227,43 @@ struct PROCHITREACT_API FHitReactTrigger_Radial : public FHitReactInputParams
 
 	FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType) { return RadialImpulse; }
 	const FHitReactImpulse& GetImpulseParamsBase(const EHitReactImpulseType& ImpulseType) const { return RadialImpulse; }
-};
\ No newline at end of file
+};
+
+/**
+ * A hit react that was requested but could not be applied immediately
+ * Stores everything required to apply it later, along with the world time it was requested at
+ */
+USTRUCT(BlueprintType)
+struct PROCHITREACT_API FHitReactQueuedHit
+{
+	GENERATED_BODY()
+
+	FHitReactQueuedHit()
+		: ImpulseScalar(1.f)
+		, HitTime(0.f)
+	{}
+
+	FHitReactQueuedHit(const FHitReactTrigger& InTrigger, const FHitReactImpulse_WorldParams& InWorld, float InImpulseScalar,
+		float InHitTime)
+		: Trigger(InTrigger)
+		, World(InWorld)
+		, ImpulseScalar(InImpulseScalar)
+		, HitTime(InHitTime)
+	{}
+
+	/** The hit react input and impulse parameters */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	FHitReactTrigger Trigger;
+
+	/** The world space parameters to apply */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	FHitReactImpulse_WorldParams World;
+
+	/** Universal scalar to apply to all impulses */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
+	float ImpulseScalar;
+
+	/** World time (UWorld::GetTimeSeconds) at which the hit react was requested */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ForceUnits="s"))
+	float HitTime;
+};
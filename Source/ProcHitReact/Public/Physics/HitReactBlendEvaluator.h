@@ -0,0 +1,149 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HitReactPhysicsPool.h"
+
+struct FHitReactPhysics;
+
+/**
+ * Evaluates the blend weights of all physics blends on UHitReact
+ * The per-blend timing is stored as structure-of-arrays and evaluated four blends at a time using VectorRegister math
+ * Each lane corresponds to the FHitReactPhysics at the same index, which retains the cold data and receives the results
+ */
+struct PROCHITREACT_API FHitReactBlendEvaluator
+{
+	/** Rebuild the lanes from the physics blends, required whenever blends are added, removed, or reordered */
+	void Build(const TArray<FHitReactPhysics>& Blends);
+
+	/**
+	 * Advance every lane and write the resulting elapsed time and blend weight to the physics blends
+	 * @param Blends Must be unchanged since the last Build()
+	 */
+	void Evaluate(float DeltaTime, TArray<FHitReactPhysics>& Blends);
+
+	/** Remove all lanes */
+	void Reset();
+
+	/** @return Number of physics blends the lanes were built from */
+	int32 Num() const { return NumBlends; }
+
+	/** @return Active physics blends ordered by lowest blend weight as of the last Evaluate(), for ReplaceLowestWeight */
+	FHitReactEvictionCandidates& GetLowestWeightCandidates() { return LowestWeightCandidates; }
+
+	/** @return Physics blends ordered by furthest along their blend out as of the last Evaluate(), for ReplaceFurthestBlendOut */
+	FHitReactEvictionCandidates& GetFurthestBlendOutCandidates() { return FurthestBlendOutCandidates; }
+
+protected:
+	/** Number of physics blends, the lanes are padded to a multiple of the vector width */
+	int32 NumBlends = 0;
+
+	/** Time since the blend began, clamped to TotalTime */
+	TArray<float> ElapsedTime;
+
+	/** Duration of the blend in, the hold begins once reached */
+	TArray<float> BlendInTime;
+
+	/** Time the hold ends and the blend out begins */
+	TArray<float> HoldEndTime;
+
+	/** Duration of the blend out */
+	TArray<float> BlendOutTime;
+
+	/** Time the blend completes */
+	TArray<float> TotalTime;
+
+	/** Easing applied to the blend in, see HitReactBlendEvaluator::EEase */
+	TArray<float> BlendInEase;
+
+	/** Easing applied to the blend out, see HitReactBlendEvaluator::EEase */
+	TArray<float> BlendOutEase;
+
+	/** UHitReactProfile::MaxBlendWeight */
+	TArray<float> MaxBlendWeight;
+
+	/** Evaluated blend weight */
+	TArray<float> BlendWeight;
+
+	/** Lanes that are ticked by FHitReactPhysics::Tick() instead, e.g. custom curves or decaying blends */
+	TBitArray<> ScalarLanes;
+
+	/** Number of set bits in ScalarLanes */
+	int32 NumScalarLanes = 0;
+
+	/** Eviction candidates found by the last Evaluate(), see EHitReactMaxBlendHandling */
+	FHitReactEvictionCandidates LowestWeightCandidates;
+	FHitReactEvictionCandidates FurthestBlendOutCandidates;
+};
+
+/**
+ * Smooths the physics blend weight of each body toward the weights requested by the physics blends on UHitReact
+ * Targets are gathered into arrays indexed by body index, then every body is smoothed and clamped using VectorRegister math
+ * Storage is retained between ticks so gathering does not allocate once warmed up
+ */
+struct PROCHITREACT_API FHitReactBodyBlendWeights
+{
+	/**
+	 * Begin gathering targets for this tick
+	 * @param Bodies The mesh bodies, their current physics blend weight is smoothed from
+	 * @param InDeltaTime Time since the last tick
+	 * @param bInPerBodyBlendRate If true, each body blends at the rate of the physics blend with the highest target
+	 *	weight for it, instead of InBlendRate
+	 * @param InBlendRate Rate every body blends toward its targets, unused when blending each body at its own rate
+	 */
+	void Begin(const TArray<FBodyInstance*>& Bodies, float InDeltaTime, bool bInPerBodyBlendRate, float InBlendRate);
+
+	/** Begin gathering targets for the next physics blend, in the order the physics blends are processed */
+	void BeginBlend();
+
+	/**
+	 * Gather the weight the current physics blend requests for a body
+	 * @param BlendRate Rate of the physics blend, only used when blending each body at its own rate
+	 */
+	void AddTarget(int32 BodyIndex, float TargetWeight, float BlendRate);
+
+	/** Smooth and clamp the weight of every body */
+	void Resolve();
+
+	/** @return The resolved weight of the body */
+	float GetBlendWeight(int32 BodyIndex) const { return BlendWeight[BodyIndex]; }
+
+	/** @return True if any body the physics blend gathered a target for has a resolved weight above Tolerance */
+	bool HasBlendWeight(int32 BlendIndex, float Tolerance) const;
+
+	/** Release all storage */
+	void Reset();
+
+protected:
+	/** Fraction of the remaining weight each physics blend moves a body toward its target */
+	float BlendFactor = 0.f;
+
+	/** Time since the last tick */
+	float DeltaTime = 0.f;
+
+	/** True if each body blends at the rate of the physics blend with the highest target weight for it */
+	bool bPerBodyBlendRate = false;
+
+	/** Weight of each body, the weight at the start of the tick until resolved */
+	TArray<float> BlendWeight;
+
+	/** Fraction of the starting weight of each body that is retained after every target is applied */
+	TArray<float> RetainedWeight;
+
+	/** Weight each body gains from its targets */
+	TArray<float> TargetWeight;
+
+	/** Bodies each physics blend gathered targets for, ranges are given by BlendOffsets */
+	TArray<int32> BlendBodies;
+
+	/** Target weight for each entry in BlendBodies, only gathered when blending each body at its own rate */
+	TArray<float> BlendTargets;
+
+	/** Rate each body blends at, and the highest target weight it was chosen by, when blending each body at its own rate */
+	TArray<float> BodyBlendRate;
+	TArray<float> BodyMaxTarget;
+
+	/** Start of the range in BlendBodies for each physics blend */
+	TArray<int32> BlendOffsets;
+};
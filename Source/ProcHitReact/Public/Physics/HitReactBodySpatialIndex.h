@@ -0,0 +1,59 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FBodyInstance;
+
+/**
+ * Bounding volume hierarchy over the physics bodies of a mesh, for resolving a world space hit to the body it struck
+ * The hierarchy is built once for a set of bodies, then its bounds are refit to the bodies at most once per frame
+ * Queries only measure the exact distance to bodies whose bounds are nearer than the closest body found so far
+ */
+struct PROCHITREACT_API FHitReactBodySpatialIndex
+{
+	/** Refit the bounds to the current body transforms, rebuilding the hierarchy if the bodies changed */
+	void Update(const TArray<FBodyInstance*>& Bodies);
+
+	/**
+	 * Find the body nearest to a world space location, Update() must have been called this frame
+	 * @param MaxDistance Bodies further than this from the location are ignored
+	 * @param IsBodyValid Return false to skip a body, called with its index into the mesh bodies
+	 * @return Index of the nearest body into the mesh bodies, or INDEX_NONE if none were found
+	 */
+	int32 FindNearestBody(const TArray<FBodyInstance*>& Bodies, const FVector& Location, float MaxDistance,
+		const TFunctionRef<bool(int32 BodyIndex)>& IsBodyValid) const;
+
+	/** Discard the hierarchy, it is rebuilt by the next Update() */
+	void Reset();
+
+protected:
+	struct FNode
+	{
+		/** World space bounds of every body below this node */
+		FBox Bounds = FBox(ForceInit);
+
+		/** Index of the first of two child nodes, or INDEX_NONE for a leaf */
+		int32 FirstChild = INDEX_NONE;
+
+		/** Range of BodyIndices contained by a leaf */
+		int32 FirstBody = 0;
+		int32 NumBodies = 0;
+	};
+
+	/** Build a node, and its children, containing BodyIndices[FirstBody, FirstBody + NumBodies) */
+	void BuildNode(int32 NodeIndex, int32 FirstBody, int32 NumBodies);
+
+	/** Nodes of the hierarchy, parents always precede their children */
+	TArray<FNode> Nodes;
+
+	/** Body indices ordered so each leaf contains a contiguous range */
+	TArray<int32> BodyIndices;
+
+	/** World space bounds of each body, indexed by body index */
+	TArray<FBox> BodyBounds;
+
+	/** Frame the bounds were last refit on */
+	uint64 UpdateFrame = 0;
+};
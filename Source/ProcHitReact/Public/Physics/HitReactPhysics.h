@@ -6,6 +6,101 @@
 #include "HitReactPhysicsState.h"
 #include "HitReactPhysics.generated.h"
 
+/**
+ * Simulate state of a single body, indexed by body index on UHitReact
+ * Applies hysteresis so bodies don't flip between kinematic and simulated under rapid overlapping hits
+ */
+struct PROCHITREACT_API FHitReactBodySimState
+{
+	/** World time the body began simulating */
+	float SimulateStartTime = 0.f;
+
+	/** Blend weight the body must exceed to begin simulating */
+	float EnableThreshold = 0.f;
+
+	/** Blend weight the body must fall to before it stops simulating */
+	float DisableThreshold = 0.f;
+
+	/** Minimum time the body simulates for once it begins simulating */
+	float MinSimulateTime = 0.f;
+
+	/** Rate the body blends out at once no physics blend touches it, e.g. because its physics blend was evicted */
+	float BlendRate = 0.f;
+
+	/** UHitReact::SimStateSerial when a physics blend last touched this body */
+	uint32 LastTouchedSerial = 0;
+
+	/** True if the simulate state of this body is managed by the hit react system */
+	bool bTracked = false;
+};
+
+/**
+ * Bodies affected by the bone overrides of a profile and its optional bone data
+ * Shared by every physics blend using the same profile and bone data, see UHitReact::GetBoneOverrides()
+ * Everything is precomputed per body for the mesh, so the hot paths never look up bones by name
+ */
+struct PROCHITREACT_API FHitReactBoneOverrides
+{
+	/** Bodies that do not simulate physics, indexed by body index */
+	TBitArray<> DisabledBodies;
+
+	/** Bodies that are disabled, or belong to UHitReact::BlacklistedBones, indexed by body index */
+	TBitArray<> ExcludedBodies;
+
+	/** Scalar applied to the blend weight of each body, indexed by body index */
+	TArray<float> BodyWeightScalars;
+
+	/**
+	 * Body that simulates when a hit react is requested on each bone, indexed by the mesh's bone index
+	 * This is the first body at or below the bone that is not excluded, in physics asset order, or INDEX_NONE
+	 */
+	TArray<int32> SimulatedBodies;
+
+	/** As SimulatedBodies, excluding the bone's own body, for hit reacts that don't include self */
+	TArray<int32> SimulatedChildBodies;
+
+	/** First body that is not excluded, for hit reacts that don't specify a bone */
+	int32 FirstSimulatedBody = INDEX_NONE;
+
+	/**
+	 * @param BoneIndex Mesh bone index the hit react was requested on, or INDEX_NONE if no bone was specified
+	 * @return Index of the body that simulates, or INDEX_NONE if there is none
+	 */
+	int32 FindSimulatedBody(int32 BoneIndex, bool bIncludeSelf) const
+	{
+		if (BoneIndex == INDEX_NONE)
+		{
+			return bIncludeSelf ? FirstSimulatedBody : INDEX_NONE;
+		}
+		const TArray<int32>& Bodies = bIncludeSelf ? SimulatedBodies : SimulatedChildBodies;
+		return Bodies.IsValidIndex(BoneIndex) ? Bodies[BoneIndex] : INDEX_NONE;
+	}
+};
+
+/**
+ * Generation checked reference to a physics blend, remains valid while the physics blends are sorted and removed
+ * See FHitReactPhysicsPool
+ */
+struct PROCHITREACT_API FHitReactPhysicsHandle
+{
+	/** Slot in the FHitReactPhysicsPool */
+	int32 Slot = INDEX_NONE;
+
+	/** Generation of the slot when the handle was allocated */
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Slot != INDEX_NONE; }
+
+	bool operator==(const FHitReactPhysicsHandle& Other) const
+	{
+		return Slot == Other.Slot && Generation == Other.Generation;
+	}
+	bool operator!=(const FHitReactPhysicsHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
 /**
  * Process hit reactions on a single bone
  * This is the core system that handles impulse application, physics blend weights, and interpolation
@@ -18,10 +113,8 @@ struct PROCHITREACT_API FHitReactPhysics
 	FHitReactPhysics()
 		: SimulatedBoneName(NAME_None)
 		, Profile(nullptr)
-		, Mesh(nullptr)
 		, RequestedBlendWeight(0.f)
 		, MaxBlendWeight(0.f)
-		, UniqueId(0)
 	{}
 
 public:
@@ -38,10 +131,6 @@ public:
 	TObjectPtr<const UHitReactProfile> Profile;
 
 public:
-	/** Mesh to apply the hit reaction to */
-	UPROPERTY()
-	TObjectPtr<USkeletalMeshComponent> Mesh;
-
 	/** Requested blend weight for this bone to apply on UHitReact::TickComponent() */
 	UPROPERTY()
 	float RequestedBlendWeight;
@@ -50,27 +139,38 @@ public:
 	UPROPERTY()
 	float MaxBlendWeight;
 
-	/** Used for comparison */
-	UPROPERTY()
-	uint64 UniqueId;
+	/** Used for comparison, and to reference this blend while PhysicsBlends are sorted and removed */
+	FHitReactPhysicsHandle Handle;
 
 public:
-	/** Bones that descend from and may include SimulatedBoneName that do not simulate physics */
-	UPROPERTY()
-	TArray<FName> DisabledBones;
-
-	/** Bones that descent from and may include SimulatedBoneWeight that have a specified MaxBoneWeight */
-	UPROPERTY()
-	TMap<FName, float> BoneWeightScalars = {};
+	/** Bones that descend from and may include SimulatedBoneName that do not simulate physics or have a specified MaxBoneWeight */
+	TSharedPtr<const FHitReactBoneOverrides> BoneOverrides;
 
 public:
 	/** Apply a hit reaction to the bone */
-	void HitReact(USkeletalMeshComponent* InMesh, const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName,
-		const TArray<FName>& InDisabledBones, const TMap<FName, float>& InBoneWeightScalars);
+	void HitReact(const TObjectPtr<const UHitReactProfile>& InProfile, const FName& BoneName,
+		const TSharedPtr<const FHitReactBoneOverrides>& InBoneOverrides);
 
 	/** Tick the hit reaction */
 	void Tick(float DeltaTime);
 
+	/** Apply the elapsed time and blend weight evaluated by FHitReactBlendEvaluator in place of Tick() */
+	void SetEvaluatedState(float ElapsedTime, float BlendWeight);
+
+	/** @return True if the body does not simulate physics */
+	bool IsBodyDisabled(int32 BodyIndex) const
+	{
+		return BoneOverrides.IsValid() && BoneOverrides->DisabledBodies.IsValidIndex(BodyIndex) &&
+			BoneOverrides->DisabledBodies[BodyIndex];
+	}
+
+	/** @return Scalar applied to the blend weight of the body */
+	float GetBodyWeightScalar(int32 BodyIndex) const
+	{
+		return BoneOverrides.IsValid() && BoneOverrides->BodyWeightScalars.IsValidIndex(BodyIndex) ?
+			BoneOverrides->BodyWeightScalars[BodyIndex] : 1.f;
+	}
+
 	/** @return True if the hit reaction is active */
 	bool IsActive() const;
 
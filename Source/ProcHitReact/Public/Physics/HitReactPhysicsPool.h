@@ -0,0 +1,104 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HitReactPhysics.h"
+
+/**
+ * Fixed capacity slot pool for UHitReact::PhysicsBlends
+ * The physics blends remain densely packed and ordered for iteration, each references a slot through its handle
+ * Slots map handles to the current index of their physics blend, and are recycled through a free list
+ * Allocated slots are linked in the order they were allocated, so the oldest physics blend is found in constant time
+ * Storage is allocated once by Init(), so starting and finishing hit reacts never touch the allocator
+ */
+struct PROCHITREACT_API FHitReactPhysicsPool
+{
+	/** Allocate storage for Capacity physics blends, all existing handles are invalidated */
+	void Init(int32 Capacity, TArray<FHitReactPhysics>& Blends);
+
+	/**
+	 * Allocate a slot for a physics blend
+	 * @param BlendIndex Index of the physics blend in PhysicsBlends
+	 * @return Invalid handle if the pool is full
+	 */
+	FHitReactPhysicsHandle Allocate(int32 BlendIndex);
+
+	/** Return the slot to the free list, invalidating the handle */
+	void Release(const FHitReactPhysicsHandle& Handle);
+
+	/** Release all slots */
+	void ReleaseAll();
+
+	/** Update the index of each physics blend after PhysicsBlends was sorted or had physics blends removed */
+	void Remap(const TArray<FHitReactPhysics>& Blends);
+
+	/** Update the index of a single physics blend after it was moved, e.g. swapped into the place of a removed one */
+	void Relocate(const FHitReactPhysicsHandle& Handle, int32 BlendIndex);
+
+	/** @return Index of the physics blend in PhysicsBlends, or INDEX_NONE if the handle is no longer valid */
+	int32 Find(const FHitReactPhysicsHandle& Handle) const;
+
+	/** @return Handle to the physics blend that was allocated first, invalid if none are allocated */
+	FHitReactPhysicsHandle GetOldest() const;
+
+	/** @return True if no slots are free */
+	bool IsFull() const { return NumFreeSlots == 0; }
+
+	/** @return Maximum number of physics blends */
+	int32 GetCapacity() const { return BlendIndices.Num(); }
+
+protected:
+	/** Index of the physics blend in PhysicsBlends for each slot, INDEX_NONE if free */
+	TArray<int32> BlendIndices;
+
+	/** Incremented each time a slot is released, so handles to a previous physics blend are rejected */
+	TArray<uint32> Generations;
+
+	/** Slots available to allocate, only the first NumFreeSlots are valid */
+	TArray<int32> FreeSlots;
+
+	/** Number of slots available to allocate */
+	int32 NumFreeSlots = 0;
+
+	/** Next allocated slot in allocation order, INDEX_NONE for the newest */
+	TArray<int32> NextSlots;
+
+	/** Previous allocated slot in allocation order, INDEX_NONE for the oldest */
+	TArray<int32> PrevSlots;
+
+	/** Slot that was allocated first */
+	int32 OldestSlot = INDEX_NONE;
+
+	/** Slot that was allocated last */
+	int32 NewestSlot = INDEX_NONE;
+};
+
+/**
+ * Eviction candidates for EHitReactMaxBlendHandling, gathered when the physics blends are evaluated
+ * Kept as a binary heap, built on the first eviction, so each eviction in a burst pops the next candidate in O(log n)
+ * Candidates that were removed since are skipped, physics blends added since are never candidates
+ */
+struct PROCHITREACT_API FHitReactEvictionCandidates
+{
+	/** Remove all candidates, retaining storage */
+	void Reset();
+
+	/** Add a candidate, those with the lowest priority are evicted first */
+	void Add(const FHitReactPhysicsHandle& Handle, float Priority);
+
+	/** @return The next candidate that is still allocated in the pool, invalid if none remain */
+	FHitReactPhysicsHandle Pop(const FHitReactPhysicsPool& Pool);
+
+protected:
+	struct FCandidate
+	{
+		FHitReactPhysicsHandle Handle;
+		float Priority = 0.f;
+	};
+
+	TArray<FCandidate> Candidates;
+
+	/** True once Candidates has been arranged as a heap */
+	bool bHeap = false;
+};
@@ -101,28 +101,27 @@ struct PROCHITREACT_API FHitReactPhysicsStateParams
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact)
 	FHitReactBlendParams BlendOut;
 
-	// Decay is not currently used and has been hidden
+	// Decay is used when UHitReactProfile::BlendMerge is Rewind
 	
 	/**
 	 * How far to rewind the hit react on reapplication
 	 */
-	// UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0", UIMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0", UIMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
 	float DecayTime;
 
 	/**
 	 * How fast to rewind the hit react on reapplication
 	 * The time scalar by which DecayTime is applied
 	 */
-	// UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0", UIMin="0", UIMax="3", Delta="0.1", ForceUnits="x"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0.1", UIMin="0.1", UIMax="3", Delta="0.1", ForceUnits="x"))
 	float DecayRate;
 
 	/**
 	 * Maximum delay that can accumulate
-	 * Will not exceed the accumulation of all blend times regardless
-	 * Will not exceed the current elapsed state time
+	 * Will not exceed the current elapsed time regardless
 	 * Set to 0 to disable this clamp
 	 */
-	// UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0", UIMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=HitReact, meta=(ClampMin="0", UIMin="0", UIMax="1", Delta="0.05", ForceUnits="s"))
 	float MaxAccumulatedDecayTime;
 
 	float GetTotalTime() const
@@ -224,12 +223,14 @@ public:
 	/** @return Total blend time for the current state */
 	float GetBlendTime() const;
 
-	// /** Apply a decay, which will cause us to rewind over time */
-	// void Decay()
-	// {
-	// 	DecayTime += Params.DecayTime;
-	// 	DecayTime = FMath::Clamp<float>(DecayTime, 0.f, Params.MaxAccumulatedDecayTime);
-	// }
+	/** Restart from the beginning of the blend in */
+	void Restart();
+
+	/** Return to the start of the hold, if the blend in has completed */
+	void ExtendHold();
+
+	/** Apply a decay, which will cause us to rewind over time */
+	void Decay();
 
 	/** @return True if decaying */
 	bool IsDecaying() const
@@ -0,0 +1,87 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Params/HitReactTrigger.h"
+#include "HitReactClientRelay.generated.h"
+
+class APlayerController;
+class UHitReact;
+
+/**
+ * A hit react sent through UHitReactClientRelay, along with the component that applies it
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactRelayedHit
+{
+	GENERATED_BODY()
+
+	FHitReactRelayedHit()
+		: HitReact(nullptr)
+	{}
+
+	FHitReactRelayedHit(UHitReact* InHitReact, const FHitReactQueuedHit& InHit)
+		: HitReact(InHitReact)
+		, Hit(InHit)
+	{}
+
+	/** Component that applies the hit react, null on the client if the owner is not relevant to it */
+	UPROPERTY()
+	TObjectPtr<UHitReact> HitReact;
+
+	/** The hit react, HitTime is in server world time */
+	UPROPERTY()
+	FHitReactQueuedHit Hit;
+};
+
+/**
+ * Delivers hit reacts to a single player, added to remote player controllers on the server ahead of their first hit react
+ * Used by UHitReact::BroadcastHitReact for profiles with a CullDistance, so only the recipients gathered by
+ * UHitReact::GetHitReactRecipients receive them, instead of every connection the owner replicates to
+ */
+UCLASS(NotBlueprintable, Within=PlayerController)
+class PROCHITREACT_API UHitReactClientRelay : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UHitReactClientRelay();
+
+	/** @return The relay on the player controller, added if it doesn't have one yet */
+	static UHitReactClientRelay* FindOrAdd(APlayerController* PlayerController);
+
+	/** Add a relay to every remote player controller in the world that doesn't have one yet */
+	static void AddToRemotePlayers(const UWorld* World);
+
+	/** @return True once the relay has replicated to the owning client, hit reacts sent before then would be dropped */
+	bool IsClientReady() const { return bClientReady; }
+
+	virtual void BeginPlay() override;
+
+	/**
+	 * Queue a hit react for the owning player
+	 * Every hit react queued during a frame is sent to the client in a single RPC, at the end of the frame
+	 */
+	void AddHit(UHitReact* HitReact, const FHitReactQueuedHit& Hit);
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	/** Send the hit reacts queued this frame to the owning player */
+	UFUNCTION(Client, Unreliable)
+	void ClientReceiveHitReacts(const TArray<FHitReactRelayedHit>& Hits);
+
+	/** Sent by the owning client once the relay has replicated to it */
+	UFUNCTION(Server, Reliable)
+	void ServerNotifyClientReady();
+
+protected:
+	/** Hit reacts queued this frame, sent by TickComponent */
+	UPROPERTY(Transient)
+	TArray<FHitReactRelayedHit> PendingHits;
+
+	/** True once the owning client has the relay, until then UHitReact::BroadcastHitReact replicates via NetHits */
+	bool bClientReady = false;
+};
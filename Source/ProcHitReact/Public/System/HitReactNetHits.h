@@ -0,0 +1,75 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Params/HitReactTrigger.h"
+#include "HitReactNetHits.generated.h"
+
+class UHitReact;
+
+/**
+ * A hit react replicated as part of FHitReactNetHitArray
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactNetHit : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	FHitReactNetHit()
+	{}
+
+	FHitReactNetHit(const FHitReactQueuedHit& InHit)
+		: Hit(InHit)
+	{}
+
+	/** The hit react, HitTime is in server world time */
+	UPROPERTY()
+	FHitReactQueuedHit Hit;
+};
+
+/**
+ * Ring buffer of recent hit reacts replicated by a UHitReact component
+ * Every hit react added during a frame is sent to clients as a single delta, which applies them as a batch
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactNetHitArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FHitReactNetHitArray()
+		: OwnerComponent(nullptr)
+	{}
+
+	/** Recent hit reacts, oldest first */
+	UPROPERTY()
+	TArray<FHitReactNetHit> Items;
+
+	/** Component that receives replicated hit reacts */
+	UPROPERTY(NotReplicated)
+	TObjectPtr<UHitReact> OwnerComponent;
+
+	/**
+	 * Add a hit react to be replicated
+	 * @param MaxHits When exceeded, the oldest hit reacts are discarded
+	 * @param StaleTime Hit reacts requested before this server time are discarded
+	 */
+	void AddHit(const FHitReactQueuedHit& Hit, int32 MaxHits, float StaleTime);
+
+	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FHitReactNetHit, FHitReactNetHitArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FHitReactNetHitArray> : public TStructOpsTypeTraitsBase2<FHitReactNetHitArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
@@ -0,0 +1,85 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Quantization helpers for replicating hit react parameters
+ */
+namespace HitReactNetQuantize
+{
+	/** Map [-1, 1] to the full range of a uint16 */
+	FORCEINLINE uint16 QuantizeSignedUnit(double Value)
+	{
+		return static_cast<uint16>(FMath::RoundToInt((FMath::Clamp(Value, -1.0, 1.0) * 0.5 + 0.5) * MAX_uint16));
+	}
+
+	/** Map the full range of a uint16 back to [-1, 1] */
+	FORCEINLINE double DequantizeSignedUnit(uint16 Value)
+	{
+		return (static_cast<double>(Value) / MAX_uint16) * 2.0 - 1.0;
+	}
+
+	FORCEINLINE double SignNotZero(double Value)
+	{
+		return Value >= 0.0 ? 1.0 : -1.0;
+	}
+
+	/**
+	 * Encode a direction as a unit-normal octahedral mapping, quantized to 16 bits per component
+	 * Zero directions are encoded as up
+	 */
+	inline void EncodeOctahedral(const FVector& Direction, uint16& OutX, uint16& OutY)
+	{
+		const FVector Normal = Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+		const double L1 = FMath::Abs(Normal.X) + FMath::Abs(Normal.Y) + FMath::Abs(Normal.Z);
+		double X = Normal.X / L1;
+		double Y = Normal.Y / L1;
+
+		// Fold the lower hemisphere over the diagonals
+		if (Normal.Z < 0.0)
+		{
+			const double FoldedX = (1.0 - FMath::Abs(Y)) * SignNotZero(X);
+			const double FoldedY = (1.0 - FMath::Abs(X)) * SignNotZero(Y);
+			X = FoldedX;
+			Y = FoldedY;
+		}
+
+		OutX = QuantizeSignedUnit(X);
+		OutY = QuantizeSignedUnit(Y);
+	}
+
+	/** Decode a unit-normal octahedral mapping, see EncodeOctahedral */
+	inline FVector DecodeOctahedral(uint16 InX, uint16 InY)
+	{
+		FVector Normal(DequantizeSignedUnit(InX), DequantizeSignedUnit(InY), 0.0);
+		Normal.Z = 1.0 - FMath::Abs(Normal.X) - FMath::Abs(Normal.Y);
+
+		// Unfold the lower hemisphere
+		const double T = FMath::Max(-Normal.Z, 0.0);
+		Normal.X -= T * SignNotZero(Normal.X);
+		Normal.Y -= T * SignNotZero(Normal.Y);
+
+		return Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector);
+	}
+
+	/** Serialize a direction as a 32 bit unit-normal octahedral encoding, loses any magnitude */
+	inline void SerializeDirection(FArchive& Ar, FVector& Direction)
+	{
+		uint16 X = 0;
+		uint16 Y = 0;
+		if (Ar.IsSaving())
+		{
+			EncodeOctahedral(Direction, X, Y);
+		}
+
+		Ar << X;
+		Ar << Y;
+
+		if (Ar.IsLoading())
+		{
+			Direction = DecodeOctahedral(X, Y);
+		}
+	}
+}
@@ -0,0 +1,123 @@
+// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "HitReactProfileCache.generated.h"
+
+class UHitReactProfile;
+struct FStreamableHandle;
+
+/**
+ * A profile that is resident in, or being loaded into, the profile cache
+ */
+USTRUCT()
+struct PROCHITREACT_API FHitReactResidentProfile
+{
+	GENERATED_BODY()
+
+	FHitReactResidentProfile()
+		: Profile(nullptr)
+		, LastUseTime(0.0)
+		, UseCount(0)
+		, SizeBytes(0)
+		, bFailed(false)
+	{}
+
+	/** The loaded profile, null while loading -- keeps the profile resident */
+	UPROPERTY()
+	TObjectPtr<const UHitReactProfile> Profile;
+
+	/** Streaming handle for the profile, only valid while loading */
+	TSharedPtr<FStreamableHandle> Handle;
+
+	/** Callbacks to execute once the profile has finished loading */
+	TArray<FSimpleDelegate> OnLoaded;
+
+	/** FPlatformTime::Seconds() when the profile was last used */
+	double LastUseTime;
+
+	/** Number of times the profile has been used since it became resident */
+	uint32 UseCount;
+
+	/** Estimated memory used by the profile */
+	SIZE_T SizeBytes;
+
+	/** True if loading failed, the profile will not be requested again */
+	bool bFailed;
+};
+
+/**
+ * Shared cache of hit react profiles used by UHitReact components with EHitReactProfileLoading::Lazy
+ * Profiles are loaded on first use and kept resident per-profile rather than per-component
+ * Profiles that have not been used for p.HitReact.ProfileCache.IdleTime are released,
+ * and the least recently used profiles are released while exceeding p.HitReact.ProfileCache.BudgetKB
+ */
+UCLASS()
+class PROCHITREACT_API UHitReactProfileCache : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** @return The profile cache, or nullptr if the engine is not available */
+	static UHitReactProfileCache* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Retrieve a resident profile and mark it as used
+	 * Profiles that are already in memory are adopted without loading
+	 * @return The profile, or nullptr if it is not resident
+	 */
+	const UHitReactProfile* UseProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile);
+
+	/**
+	 * Load a profile and keep it resident
+	 * @param OnLoaded Called when the profile has finished loading, or immediately if already resident
+	 * @return False if the profile is null or previously failed to load
+	 */
+	bool RequestProfile(const TSoftObjectPtr<UHitReactProfile>& SoftProfile, const FSimpleDelegate& OnLoaded);
+
+	/** @return True if the profile failed to load */
+	bool HasProfileFailed(const TSoftObjectPtr<UHitReactProfile>& SoftProfile) const;
+
+	/** @return Number of times the profile has been used since it became resident */
+	uint32 GetProfileUseCount(const TSoftObjectPtr<UHitReactProfile>& SoftProfile) const;
+
+	/** @return Estimated memory used by all resident profiles */
+	SIZE_T GetResidentBytes() const { return ResidentBytes; }
+
+	/**
+	 * Release profiles that have been idle for too long, then the least recently used until within budget
+	 * Called periodically, profiles that are still referenced by an active hit react remain loaded until it completes
+	 */
+	void ReleaseUnusedProfiles();
+
+	/** Log all profiles in the cache */
+	void DumpProfiles() const;
+
+protected:
+	/** Called by the streamable manager when a profile has finished loading */
+	void OnProfileLoaded(FSoftObjectPath ProfilePath);
+
+	/** Remove a profile from the cache, allowing it to be garbage collected once unreferenced */
+	void ReleaseProfile(const FSoftObjectPath& ProfilePath);
+
+	/** Make a loaded profile resident */
+	void MakeResident(FHitReactResidentProfile& Resident, const UHitReactProfile* Profile);
+
+	bool TickEviction(float DeltaTime);
+
+protected:
+	/** All profiles that are resident or loading */
+	UPROPERTY(Transient)
+	TMap<FSoftObjectPath, FHitReactResidentProfile> Profiles;
+
+	/** Estimated memory used by all resident profiles */
+	SIZE_T ResidentBytes = 0;
+
+	FTSTicker::FDelegateHandle EvictionTickerHandle;
+};
@@ -0,0 +1,117 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Params/HitReactImpulse.h"
+#include "Params/HitReactParams.h"
+#include "UObject/ObjectKey.h"
+
+class UHitReact;
+class UWorld;
+
+/**
+ * A component that appears in a hit react recording
+ */
+struct PROCHITREACT_API FHitReactRecordedComponent
+{
+	/** Class of the owning actor, spawned when replaying */
+	FSoftClassPath OwnerClass;
+
+	/** Class of the hit react component, found on the spawned owner when replaying */
+	FSoftClassPath ComponentClass;
+
+	/** Owner transform when the component was first recorded */
+	FTransform OwnerTransform;
+
+	friend FArchive& operator<<(FArchive& Ar, FHitReactRecordedComponent& Component)
+	{
+		Ar << Component.OwnerClass;
+		Ar << Component.ComponentClass;
+		Ar << Component.OwnerTransform;
+		return Ar;
+	}
+};
+
+/**
+ * A single accepted hit react
+ */
+struct PROCHITREACT_API FHitReactRecordedHit
+{
+	/** World seconds since the recording started, when the hit react was requested */
+	float Time = 0.f;
+
+	/** Index into FHitReactRecording::Components */
+	uint32 ComponentId = 0;
+
+	/** Input params in their compact net representation, see UHitReact::MakeCompactNetParams */
+	FHitReactInputParams Params;
+
+	FHitReactImpulseParams Impulse;
+
+	/** World params, RadialLocation is relative to the owner when bNetRadialRelative is set */
+	FHitReactImpulse_WorldParams World;
+
+	float ImpulseScalar = 1.f;
+
+	void Serialize(FArchive& Ar);
+};
+
+/**
+ * A stream of hit reacts captured by FHitReactRecorder, replayed by the HitReactReplay commandlet
+ */
+struct PROCHITREACT_API FHitReactRecording
+{
+	static constexpr uint32 Magic = 0x43525248;  // 'HRRC'
+	static constexpr uint32 Version = 1;
+
+	TArray<FHitReactRecordedComponent> Components;
+
+	/** Recorded hit reacts, sorted by Time once saved or loaded */
+	TArray<FHitReactRecordedHit> Hits;
+
+	void Serialize(FArchive& Ar);
+
+	/** Sort Hits by Time, retaining the order of simultaneous hit reacts */
+	void SortHits();
+
+	bool SaveToFile(const FString& Filename);
+	bool LoadFromFile(const FString& Filename);
+};
+
+/**
+ * Records every accepted hit react to a compact binary file, so real traffic can be replayed deterministically
+ * p.HitReact.Record.Start [Filename] and p.HitReact.Record.Stop, not available in shipping builds
+ */
+class PROCHITREACT_API FHitReactRecorder
+{
+public:
+	static FHitReactRecorder& Get();
+
+	/** Cheap check to early out before gathering anything to record */
+	static bool IsRecording() { return bRecording; }
+
+	/** Start recording, discarding anything recorded but not saved */
+	void Start(const FString& InFilename);
+
+	/** Stop recording and save to file */
+	bool Stop();
+
+	/** Record an accepted hit react */
+	void Record(const UHitReact* Component, const FHitReactInputParams& Params, const FHitReactImpulseParams& Impulse,
+		const FHitReactImpulse_WorldParams& WorldParams, float ImpulseScalar, float HitTime);
+
+private:
+	static bool bRecording;
+
+	FHitReactRecording Recording;
+	FString Filename;
+
+	/** Platform time recording started */
+	double StartTime = 0.0;
+
+	/** World time of each recorded world when recording started */
+	TMap<TObjectKey<UWorld>, double> WorldStartTimes;
+
+	TMap<TObjectKey<UHitReact>, uint32> ComponentIds;
+};
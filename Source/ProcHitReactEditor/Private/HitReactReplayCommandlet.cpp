@@ -0,0 +1,121 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "HitReactReplayCommandlet.h"
+
+#include "HitReact.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/CommandLine.h"
+#include "System/HitReactRecorder.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(HitReactReplayCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogHitReactReplay, Log, All);
+
+/** Keep ticking after the last hit react so its blend can complete */
+static constexpr float HitReactReplayTailTime = 2.f;
+
+UHitReactReplayCommandlet::UHitReactReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UHitReactReplayCommandlet::Main(const FString& Params)
+{
+	FString Filename;
+	if (!FParse::Value(*Params, TEXT("File="), Filename))
+	{
+		UE_LOG(LogHitReactReplay, Error, TEXT("Usage: -run=HitReactReplay -File=<Recording> [-FPS=60] [-Loops=1]"));
+		return 1;
+	}
+
+	float FPS = 60.f;
+	FParse::Value(*Params, TEXT("FPS="), FPS);
+	int32 Loops = 1;
+	FParse::Value(*Params, TEXT("Loops="), Loops);
+
+	FHitReactRecording Recording;
+	if (!Recording.LoadFromFile(Filename))
+	{
+		UE_LOG(LogHitReactReplay, Error, TEXT("Failed to load recording { %s }"), *Filename);
+		return 1;
+	}
+
+	// Headless game world to spawn the owners in
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("HitReactReplay"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// Spawn an owner for each recorded component
+	TArray<TWeakObjectPtr<UHitReact>> Components;
+	Components.SetNum(Recording.Components.Num());
+	for (int32 ComponentId = 0; ComponentId < Recording.Components.Num(); ComponentId++)
+	{
+		const FHitReactRecordedComponent& Recorded = Recording.Components[ComponentId];
+		UClass* OwnerClass = Recorded.OwnerClass.TryLoadClass<AActor>();
+		UClass* ComponentClass = Recorded.ComponentClass.TryLoadClass<UHitReact>();
+		if (!OwnerClass || !ComponentClass)
+		{
+			UE_LOG(LogHitReactReplay, Warning, TEXT("Failed to load { %s } with { %s }, its hit reacts are skipped"),
+				*Recorded.OwnerClass.ToString(), *Recorded.ComponentClass.ToString());
+			continue;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		const AActor* Owner = World->SpawnActor<AActor>(OwnerClass, Recorded.OwnerTransform, SpawnParams);
+		Components[ComponentId] = Owner ? Cast<UHitReact>(Owner->GetComponentByClass(ComponentClass)) : nullptr;
+	}
+
+	// Profiles are loaded asynchronously when the components activate
+	FlushAsyncLoading();
+
+	const float DeltaTime = 1.f / FMath::Max(1.f, FPS);
+	const float Duration = Recording.Hits.Num() > 0 ? Recording.Hits.Last().Time + HitReactReplayTailTime : 0.f;
+	int32 NumFrames = 0;
+	int32 NumApplied = 0;
+	double TickSeconds = 0.0;
+
+	for (int32 Loop = 0; Loop < FMath::Max(1, Loops); Loop++)
+	{
+		float ReplayTime = 0.f;
+		int32 HitIndex = 0;
+		while (ReplayTime < Duration)
+		{
+			// Apply every hit react that was recorded up to this point
+			for (; HitIndex < Recording.Hits.Num() && Recording.Hits[HitIndex].Time <= ReplayTime; HitIndex++)
+			{
+				const FHitReactRecordedHit& Hit = Recording.Hits[HitIndex];
+				UHitReact* Component = Components.IsValidIndex(Hit.ComponentId) ? Components[Hit.ComponentId].Get() : nullptr;
+				if (Component && Component->HitReact(Hit.Params, Hit.Impulse, Hit.World, Hit.ImpulseScalar))
+				{
+					NumApplied++;
+				}
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			World->Tick(LEVELTICK_All, DeltaTime);
+			TickSeconds += FPlatformTime::Seconds() - StartTime;
+
+			FTSTicker::GetCoreTicker().Tick(DeltaTime);
+			ReplayTime += DeltaTime;
+			NumFrames++;
+		}
+	}
+
+	UE_LOG(LogHitReactReplay, Display, TEXT("Replayed %d of %d hit reacts on %d components over %d frames, world tick %.3f ms/frame"),
+		NumApplied, Recording.Hits.Num() * FMath::Max(1, Loops), Recording.Components.Num(), NumFrames,
+		NumFrames > 0 ? TickSeconds * 1000.0 / NumFrames : 0.0);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return 0;
+}
@@ -0,0 +1,24 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "HitReactReplayCommandlet.generated.h"
+
+/**
+ * Replays a hit react recording headlessly against freshly spawned owners, for reproducible performance captures
+ * Recordings are made with p.HitReact.Record.Start and p.HitReact.Record.Stop
+ *
+ * Usage: -run=HitReactReplay -File=<Recording> [-FPS=60] [-Loops=1]
+ */
+UCLASS()
+class UHitReactReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UHitReactReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,30 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "AnimGraphNode_HitReactSpring.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AnimGraphNode_HitReactSpring)
+
+#define LOCTEXT_NAMESPACE "AnimGraphNode_HitReactSpring"
+
+FText UAnimGraphNode_HitReactSpring::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	return LOCTEXT("NodeTitle", "Hit React Spring");
+}
+
+FText UAnimGraphNode_HitReactSpring::GetTooltipText() const
+{
+	return LOCTEXT("NodeTooltip", "Physics-free hit reactions for distant or low LOD characters. Hit reacts beyond the LOD Threshold of a profile with Spring Fallback drive a damped spring on the hit bone chain.");
+}
+
+FLinearColor UAnimGraphNode_HitReactSpring::GetNodeTitleColor() const
+{
+	return FLinearColor(0.75f, 0.2f, 0.2f);
+}
+
+FString UAnimGraphNode_HitReactSpring::GetNodeCategory() const
+{
+	return TEXT("ProcHitReact");
+}
+
+#undef LOCTEXT_NAMESPACE
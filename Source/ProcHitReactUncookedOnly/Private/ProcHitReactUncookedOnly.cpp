@@ -0,0 +1,3 @@
+﻿#include "ProcHitReactUncookedOnly.h"
+
+IMPLEMENT_MODULE(FProcHitReactUncookedOnlyModule, ProcHitReactUncookedOnly)
\ No newline at end of file
@@ -0,0 +1,27 @@
+﻿using UnrealBuildTool;
+
+public class ProcHitReactUncookedOnly : ModuleRules
+{
+    public ProcHitReactUncookedOnly(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "AnimGraph",
+            }
+        );
+
+        PrivateDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "CoreUObject",
+                "Engine",
+                "ProcHitReact",
+                "BlueprintGraph",
+            }
+        );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AnimGraphNode_Base.h"
+#include "Animation/AnimNode_HitReactSpring.h"
+#include "AnimGraphNode_HitReactSpring.generated.h"
+
+/**
+ * Anim graph node for FAnimNode_HitReactSpring
+ */
+UCLASS()
+class PROCHITREACTUNCOOKEDONLY_API UAnimGraphNode_HitReactSpring : public UAnimGraphNode_Base
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Category=Settings)
+	FAnimNode_HitReactSpring Node;
+
+public:
+	virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+	virtual FText GetTooltipText() const override;
+	virtual FLinearColor GetNodeTitleColor() const override;
+	virtual FString GetNodeCategory() const override;
+};
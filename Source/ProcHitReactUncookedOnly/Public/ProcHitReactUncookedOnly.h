@@ -0,0 +1,8 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FProcHitReactUncookedOnlyModule : public IModuleInterface
+{
+};
\ No newline at end of file